@@ -0,0 +1,162 @@
+
+# include <chrono>
+# include <string>
+# include <vector>
+# include <iostream>
+# include <IdsMapping.hh>
+
+namespace {
+
+  /**
+   * @brief - Number of items registered in the mapping for each scenario.
+   */
+  constexpr int sk_items = 10000;
+
+  /**
+   * @brief - Flat tables relabeling the items located after each modified
+   *          position. This is the previous implementation of the mapping,
+   *          kept as a reference for the measurements.
+   */
+  class FlatMapping {
+    public:
+
+      int
+      getPhysicalID(int logicID) const noexcept {
+        return m_logicToPhys[logicID];
+      }
+
+      int
+      getLogicalID(int physID) const noexcept {
+        return m_physToLogic[physID];
+      }
+
+      int
+      insert(int logicID, int physID) {
+        m_logicToPhys.insert(m_logicToPhys.cbegin() + logicID, physID);
+        if (physID >= static_cast<int>(m_physToLogic.size())) {
+          m_physToLogic.resize(physID + 1, -1);
+        }
+
+        relabel(logicID);
+        return logicID;
+      }
+
+      void
+      erase(int logicID) {
+        m_physToLogic[m_logicToPhys[logicID]] = -1;
+        m_logicToPhys.erase(m_logicToPhys.cbegin() + logicID);
+
+        relabel(logicID);
+      }
+
+    private:
+
+      void
+      relabel(int from) {
+        for (int id = from ; id < static_cast<int>(m_logicToPhys.size()) ; ++id) {
+          m_physToLogic[m_logicToPhys[id]] = id;
+        }
+      }
+
+      std::vector<int> m_logicToPhys;
+      std::vector<int> m_physToLogic;
+  };
+
+  /**
+   * @brief - Runs the `process` and prints the average time of one of the
+   *          `count` operations it performs.
+   * @param name - the name of the measurement.
+   * @param count - the number of operations performed by the process.
+   * @param process - the process to measure.
+   * @return - a value computed by the process so that it is not optimized out.
+   */
+  template <typename Process>
+  long
+  measure(const std::string& name,
+          int count,
+          Process process)
+  {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const long result = process();
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << name << ": " << ns / count << " ns/op" << std::endl;
+
+    return result;
+  }
+
+  /**
+   * @brief - Measures the typical operations of a layout on the `Mapping`: a
+   *          list of `sk_items` items built by inserting each new item in the
+   *          middle, converted in both directions and then emptied from the
+   *          middle. The list is finally rebuilt with a conversion after each
+   *          insertion as done when a layout handles its items one by one.
+   * @param name - the name of the mapping.
+   * @return - a checksum of the conversions.
+   */
+  template <typename Mapping>
+  long
+  run(const std::string& name) {
+    std::cout << name << " (" << sk_items << " items)" << std::endl;
+
+    Mapping mapping;
+    long checksum = 0;
+
+    checksum += measure("insert middle", sk_items, [&mapping]() {
+      for (int id = 0 ; id < sk_items ; ++id) {
+        mapping.insert(id / 2, id);
+      }
+      return 0l;
+    });
+
+    checksum += measure("logical to physical", sk_items, [&mapping]() {
+      long sum = 0;
+      for (int id = 0 ; id < sk_items ; ++id) {
+        sum += mapping.getPhysicalID(id);
+      }
+      return sum;
+    });
+
+    checksum += measure("physical to logical", sk_items, [&mapping]() {
+      long sum = 0;
+      for (int id = 0 ; id < sk_items ; ++id) {
+        sum += mapping.getLogicalID(id);
+      }
+      return sum;
+    });
+
+    checksum += measure("erase middle", sk_items, [&mapping]() {
+      for (int id = sk_items ; id > 0 ; --id) {
+        mapping.erase(id / 2);
+      }
+      return 0l;
+    });
+
+    checksum += measure("insert middle and convert", sk_items, [&mapping]() {
+      long sum = 0;
+      for (int id = 0 ; id < sk_items ; ++id) {
+        const int logic = mapping.insert(id / 2, id);
+        sum += mapping.getLogicalID(id) - logic;
+      }
+      return sum;
+    });
+
+    return checksum;
+  }
+
+}
+
+int
+main(int /*argc*/, char** /*argv*/) {
+  const long flat = run<FlatMapping>("Flat tables");
+  const long tree = run<sdl::graphic::IdsMapping>("IdsMapping");
+
+  // Both mappings should agree on the conversions.
+  if (flat != tree) {
+    std::cerr << "Mappings disagree (" << flat << " != " << tree << ")" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,159 @@
+
+# include <chrono>
+# include <string>
+# include <vector>
+# include <iostream>
+# include <string_view>
+# include <IntValidator.hh>
+# include <StaticValidator.hh>
+
+namespace {
+
+  /**
+   * @brief - Number of values validated in each scenario.
+   */
+  constexpr int sk_values = 1000000;
+
+  /**
+   * @brief - Range of the values considered valid by the validators.
+   */
+  constexpr int sk_lower = -5000;
+  constexpr int sk_upper = 5000;
+
+  using State = sdl::graphic::Validator::State;
+
+  /**
+   * @brief - Runs the `process` and prints the average time needed to validate
+   *          one of the `sk_values` values.
+   * @param name - the name of the measurement.
+   * @param process - the process to measure.
+   * @return - the number of values considered valid by the process.
+   */
+  template <typename Process>
+  long
+  measure(const std::string& name,
+          Process process)
+  {
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const long valid = process();
+    const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    const double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    std::cout << "  " << name << ": " << ns / sk_values << " ns/value (" << valid << " valid)" << std::endl;
+
+    return valid;
+  }
+
+  /**
+   * @brief - Generates a column of values as imported from a file: mostly numbers
+   *          in and out of the range with a few malformed entries.
+   * @return - the generated values.
+   */
+  std::vector<std::string>
+  generate() {
+    std::vector<std::string> values;
+    values.reserve(sk_values);
+
+    unsigned seed = 0x2545f491u;
+
+    for (int id = 0 ; id < sk_values ; ++id) {
+      seed ^= (seed << 13u);
+      seed ^= (seed >> 17u);
+      seed ^= (seed << 5u);
+
+      const int value = static_cast<int>(seed % 20001u) - 10000;
+
+      switch (seed % 16u) {
+        case 0u:
+          values.push_back(std::to_string(value) + "x");
+          break;
+        case 1u:
+          values.push_back(std::to_string(value) + ".5");
+          break;
+        default:
+          values.push_back(std::to_string(value));
+          break;
+      }
+    }
+
+    return values;
+  }
+
+  /**
+   * @brief - Counts the valid states of the input array.
+   * @param states - the states to count.
+   * @return - the number of valid states.
+   */
+  long
+  countValid(const sdl::graphic::Validator::States& states) {
+    long valid = 0;
+    for (State state : states) {
+      valid += (state == State::Valid ? 1 : 0);
+    }
+
+    return valid;
+  }
+
+}
+
+int
+main(int /*argc*/, char** /*argv*/) {
+  using namespace sdl::graphic;
+
+  const std::vector<std::string> values = generate();
+  const std::vector<std::string_view> views(values.cbegin(), values.cend());
+
+  std::cout << "Integer validation (" << sk_values << " values)" << std::endl;
+
+  const StaticValidator<validation::Integer, validation::Range<int>> inlined(
+    validation::Integer(),
+    validation::Range<int>(sk_lower, sk_upper)
+  );
+
+  const ValidatorShPtr dynamic = std::make_shared<IntValidator>(sk_lower, sk_upper);
+  const ValidatorShPtr adapter = makeValidator(inlined);
+
+  const long reference = measure("StaticValidator (inlined)", [&inlined, &views]() {
+    long valid = 0;
+    for (std::string_view value : views) {
+      valid += (inlined.validate(value) == State::Valid ? 1 : 0);
+    }
+    return valid;
+  });
+
+  const long checks[] = {
+    measure("IntValidator (virtual call)", [&dynamic, &values]() {
+      long valid = 0;
+      for (const std::string& value : values) {
+        valid += (dynamic->validate(value) == State::Valid ? 1 : 0);
+      }
+      return valid;
+    }),
+
+    measure("StaticValidator adapter (virtual call)", [&adapter, &values]() {
+      long valid = 0;
+      for (const std::string& value : values) {
+        valid += (adapter->validate(value) == State::Valid ? 1 : 0);
+      }
+      return valid;
+    }),
+
+    measure("IntValidator (validateAll)", [&dynamic, &views]() {
+      return countValid(dynamic->validateAll(views));
+    }),
+
+    measure("StaticValidator adapter (validateAll)", [&adapter, &views]() {
+      return countValid(adapter->validateAll(views));
+    })
+  };
+
+  // All the validators should accept the same values.
+  for (long valid : checks) {
+    if (valid != reference) {
+      std::cerr << "Validators disagree (" << valid << " != " << reference << ")" << std::endl;
+      return 1;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+
+# include "BlinkTimer.hh"
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    const std::chrono::milliseconds BlinkTimer::sk_interval(500);
+
+    BlinkTimer::BlinkTimer():
+      m_locker(),
+      m_waiter(),
+
+      m_subscribers(),
+
+      m_visible(true),
+      m_nextToggle(),
+
+      m_running(true),
+
+      m_thread()
+    {
+      // Nothing to do.
+    }
+
+    BlinkTimer::~BlinkTimer() {
+      {
+        const std::lock_guard guard(m_locker);
+        m_running = false;
+      }
+
+      m_waiter.notify_all();
+
+      if (m_thread.joinable()) {
+        m_thread.join();
+      }
+    }
+
+    void
+    BlinkTimer::subscribe(const void* owner,
+                          Callback callback)
+    {
+      const std::lock_guard guard(m_locker);
+
+      // The first subscriber starts a new blink cycle: the elements are visible
+      // for a whole phase before being hidden.
+      if (m_subscribers.empty()) {
+        m_visible = true;
+        m_nextToggle = std::chrono::steady_clock::now() + sk_interval;
+      }
+
+      m_subscribers[owner] = callback;
+
+      if (!m_thread.joinable()) {
+        m_thread = std::thread(&BlinkTimer::run, this);
+      }
+
+      m_waiter.notify_all();
+    }
+
+    void
+    BlinkTimer::run() {
+      std::unique_lock guard(m_locker);
+
+      while (m_running) {
+        // Sleep until someone needs to blink.
+        if (m_subscribers.empty()) {
+          m_waiter.wait(
+            guard,
+            [this]() {
+              return !m_running || !m_subscribers.empty();
+            }
+          );
+
+          continue;
+        }
+
+        // Wait for the end of the current phase unless the timer is destroyed
+        // in the meantime.
+        if (m_waiter.wait_until(guard, m_nextToggle, [this]() { return !m_running; })) {
+          break;
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (m_subscribers.empty() || now < m_nextToggle) {
+          continue;
+        }
+
+        // Do not try to catch up with phases which were missed (for example if
+        // the process was suspended).
+        m_visible = !m_visible;
+        m_nextToggle = std::max(m_nextToggle, now) + sk_interval;
+
+        for (Subscribers::const_iterator it = m_subscribers.cbegin() ; it != m_subscribers.cend() ; ++it) {
+          it->second(m_visible);
+        }
+      }
+    }
+
+  }
+}
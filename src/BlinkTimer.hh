@@ -0,0 +1,113 @@
+#ifndef    BLINK_TIMER_HH
+# define   BLINK_TIMER_HH
+
+# include <mutex>
+# include <chrono>
+# include <thread>
+# include <functional>
+# include <unordered_map>
+# include <condition_variable>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Timer shared by all the widgets needing to blink (typically the cursor
+     *          of text boxes). A single thread toggles a global phase at a regular
+     *          interval and notifies each subscriber with the new phase so that all
+     *          the elements blink in sync.
+     *          When no subscriber is registered the thread sleeps until one comes
+     *          in: a user interface where nothing blinks does not wake up at all.
+     *          Subscribers are notified from the timer's thread while its internal
+     *          lock is held: `subscribe` and `unsubscribe` should not be called with
+     *          a lock which is also acquired by a callback.
+     */
+    class BlinkTimer {
+      public:
+
+        /**
+         * @brief - Callback receiving the new phase of the blink: `true` means that
+         *          the blinking elements should be displayed.
+         */
+        using Callback = std::function<void(bool)>;
+
+        /**
+         * @brief - Retrieves the timer shared by the application. The thread of the
+         *          timer is only started upon registering the first subscriber.
+         * @return - the shared blink timer.
+         */
+        static
+        BlinkTimer&
+        getInstance();
+
+        ~BlinkTimer();
+
+        /**
+         * @brief - Registers the callback to notify on each phase change. Any callback
+         *          already registered for the same `owner` is replaced.
+         * @param owner - the element to which the callback belongs.
+         * @param callback - the callback to notify.
+         */
+        void
+        subscribe(const void* owner,
+                  Callback callback);
+
+        /**
+         * @brief - Removes the callback registered for the `owner` if any. Once this
+         *          method returns the callback is guaranteed not to be called anymore.
+         * @param owner - the element for which the callback should be removed.
+         */
+        void
+        unsubscribe(const void* owner);
+
+      private:
+
+        BlinkTimer();
+
+        /**
+         * @brief - The main loop of the timer's thread: waits for subscribers and then
+         *          toggles the phase regularly until the timer is destroyed.
+         */
+        void
+        run();
+
+      private:
+
+        using Subscribers = std::unordered_map<const void*, Callback>;
+
+        /**
+         * @brief - The duration of a single phase of the blink.
+         */
+        static const std::chrono::milliseconds sk_interval;
+
+        /**
+         * @brief - Protects the subscribers and the phase of the timer. Held during
+         *          the notification of the subscribers.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - Used to wake up the timer's thread when the first subscriber is
+         *          registered or when the timer is destroyed.
+         */
+        std::condition_variable m_waiter;
+
+        Subscribers m_subscribers;
+
+        /**
+         * @brief - The current phase of the blink and the time at which it ends.
+         */
+        bool m_visible;
+        std::chrono::steady_clock::time_point m_nextToggle;
+
+        bool m_running;
+
+        std::thread m_thread;
+    };
+
+  }
+}
+
+# include "BlinkTimer.hxx"
+
+#endif    /* BLINK_TIMER_HH */
@@ -0,0 +1,26 @@
+#ifndef    BLINK_TIMER_HXX
+# define   BLINK_TIMER_HXX
+
+# include "BlinkTimer.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    BlinkTimer&
+    BlinkTimer::getInstance() {
+      static BlinkTimer timer;
+      return timer;
+    }
+
+    inline
+    void
+    BlinkTimer::unsubscribe(const void* owner) {
+      const std::lock_guard guard(m_locker);
+      m_subscribers.erase(owner);
+    }
+
+  }
+}
+
+#endif    /* BLINK_TIMER_HXX */
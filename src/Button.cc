@@ -27,8 +27,9 @@ namespace sdl {
       m_borders(BordersData{
         utils::Uuid(),
         utils::Uuid(),
-        utils::Uuid(),
-        utils::Uuid(),
+
+        std::string(),
+        std::string(),
 
         std::max(0.0f, bordersSize),
 
@@ -55,81 +56,60 @@ namespace sdl {
         m_bordersChanged = false;
       }
 
-      // Repaint the borders on the side of the widget. Note that we assume that both
-      // areas are similar in size (light and dark ones).
+      // The borders are drawn as a nine-slice frame (without its center) from the
+      // shared source textures which are stretched to the size of each slice. The
+      // slices are computed from the size of the widget: the thickness of a border
+      // is clamped so that opposite borders do not overlap.
       utils::Boxf thisArea = LayoutItem::getRenderingArea().toOrigin();
       utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
-      utils::Sizef hSize = getEngine().queryTexture(m_borders.hLightBorder);
-      utils::Sizef vSize = getEngine().queryTexture(m_borders.vLightBorder);
+      utils::Sizef srcSize = getBorderSourceSize();
+
+      const float s = std::min(m_borders.size, std::min(thisArea.w(), thisArea.h()) / 2.0f);
+      const float inW = thisArea.w() - 2.0f * s;
+      const float inH = thisArea.h() - 2.0f * s;
+      const float xOff = (thisArea.w() - s) / 2.0f;
+      const float yOff = (thisArea.h() - s) / 2.0f;
 
       // Determine which borders should be displayed where based on the status of this
       // button. According to whether it is pressed we will alternate the dark and light
-      // borders to create a feeling of depth.
-      utils::Uuid vl = (m_borders.pressed ? m_borders.vDarkBorder : m_borders.vLightBorder);
-      utils::Uuid vr = (m_borders.pressed ? m_borders.vLightBorder : m_borders.vDarkBorder);
-      utils::Uuid ht = (m_borders.pressed ? m_borders.vDarkBorder : m_borders.vLightBorder);
-      utils::Uuid hb = (m_borders.pressed ? m_borders.vLightBorder : m_borders.vDarkBorder);
-
-      // Compute the position of each border based on its size and the size of this area.
-      utils::Boxf vFromL(-thisArea.w() / 2.0f + vSize.w() / 2.0f, 0.0f, vSize);
-      utils::Boxf vFromR(thisArea.w() / 2.0f - vSize.w() / 2.0f, 0.0f, vSize);
-      utils::Boxf hFromT(0.0f, thisArea.h() / 2.0f - hSize.h() / 2.0f, hSize);
-      utils::Boxf hFromB(0.0f, -thisArea.h() / 2.0f + hSize.h() / 2.0f, hSize);
-
-      // Intersect these boxes with the input area to determine which part of the borders
-      // should be displayed.
-      utils::Boxf dVFromL = vFromL.intersect(area);
-      utils::Boxf dVFromR = vFromR.intersect(area);
-      utils::Boxf dHFromT = hFromT.intersect(area);
-      utils::Boxf dHFromB = hFromB.intersect(area);
-
-      // Determine the source area from the output area.
-      utils::Boxf sVFromL = convertToLocal(dVFromL, vFromL);
-      utils::Boxf sVFromR = convertToLocal(dVFromR, vFromR);
-      utils::Boxf sHFromT = convertToLocal(dHFromT, hFromT);
-      utils::Boxf sHFromB = convertToLocal(dHFromB, hFromB);
-
-      // Convert boxes to engine format.
-      utils::Boxf sVFromLEngine = convertToEngineFormat(sVFromL, vSize);
-      utils::Boxf sVFromREngine = convertToEngineFormat(sVFromR, vSize);
-      utils::Boxf sHFromTEngine = convertToEngineFormat(sHFromT, hSize);
-      utils::Boxf sHFromBEngine = convertToEngineFormat(sHFromB, hSize);
-
-      utils::Boxf dVFromLEngine = convertToEngineFormat(dVFromL, sizeEnv);
-      utils::Boxf dVFromREngine = convertToEngineFormat(dVFromR, sizeEnv);
-      utils::Boxf dHFromTEngine = convertToEngineFormat(dHFromT, sizeEnv);
-      utils::Boxf dHFromBEngine = convertToEngineFormat(dHFromB, sizeEnv);
-
-      // Draw borders. We want the dark borders to always be displayed on top so
-      // that they get most of the area. This also guarantees consistent visual
-      // aspect for the button.
-      if (m_borders.pressed) {
-        if (dVFromR.valid()) {
-          getEngine().drawTexture(vr, &sVFromREngine, &uuid, &dVFromREngine);
-        }
-        if (dHFromB.valid()) {
-          getEngine().drawTexture(hb, &sHFromBEngine, &uuid, &dHFromBEngine);
-        }
-        if (dVFromL.valid()) {
-          getEngine().drawTexture(vl, &sVFromLEngine, &uuid, &dVFromLEngine);
-        }
-        if (dHFromT.valid()) {
-          getEngine().drawTexture(ht, &sHFromTEngine, &uuid, &dHFromTEngine);
-        }
-      }
-      else {
-        if (dVFromL.valid()) {
-          getEngine().drawTexture(vl, &sVFromLEngine, &uuid, &dVFromLEngine);
-        }
-        if (dHFromT.valid()) {
-          getEngine().drawTexture(ht, &sHFromTEngine, &uuid, &dHFromTEngine);
-        }
-        if (dVFromR.valid()) {
-          getEngine().drawTexture(vr, &sVFromREngine, &uuid, &dVFromREngine);
+      // borders to create a feeling of depth. The top right and bottom left corners are
+      // always dark.
+      const utils::Uuid& tl = (m_borders.pressed ? m_borders.dark : m_borders.light);
+      const utils::Uuid& br = (m_borders.pressed ? m_borders.light : m_borders.dark);
+
+      const std::pair<utils::Boxf, utils::Uuid> slices[] = {
+        std::make_pair(utils::Boxf(-xOff, yOff, utils::Sizef(s, s)), tl),
+        std::make_pair(utils::Boxf(0.0f, yOff, utils::Sizef(inW, s)), tl),
+        std::make_pair(utils::Boxf(xOff, yOff, utils::Sizef(s, s)), m_borders.dark),
+        std::make_pair(utils::Boxf(-xOff, 0.0f, utils::Sizef(s, inH)), tl),
+        std::make_pair(utils::Boxf(xOff, 0.0f, utils::Sizef(s, inH)), br),
+        std::make_pair(utils::Boxf(-xOff, -yOff, utils::Sizef(s, s)), m_borders.dark),
+        std::make_pair(utils::Boxf(0.0f, -yOff, utils::Sizef(inW, s)), br),
+        std::make_pair(utils::Boxf(xOff, -yOff, utils::Sizef(s, s)), br)
+      };
+
+      // The source textures have a single color: the whole texture can be used
+      // whatever the part of the slice to update.
+      utils::Boxf srcEngine = convertToEngineFormat(
+        utils::Boxf(0.0f, 0.0f, srcSize),
+        srcSize
+      );
+
+      for (unsigned id = 0u ; id < sizeof(slices) / sizeof(slices[0]) ; ++id) {
+        const utils::Boxf& slice = slices[id].first;
+        if (slice.w() <= 0.0f || slice.h() <= 0.0f) {
+          continue;
         }
-        if (dHFromB.valid()) {
-          getEngine().drawTexture(hb, &sHFromBEngine, &uuid, &dHFromBEngine);
+
+        // Only draw the part of the slice which should be updated.
+        utils::Boxf dst = slice.intersect(area);
+        if (!dst.valid()) {
+          continue;
         }
+
+        utils::Boxf dstEngine = convertToEngineFormat(dst, sizeEnv);
+
+        getEngine().drawTexture(slices[id].second, &srcEngine, &uuid, &dstEngine);
       }
     }
 
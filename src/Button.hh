@@ -196,20 +196,51 @@ namespace sdl {
         void
         setBordersChanged();
 
+        /**
+         * @brief - Retrieves the size of the textures used as source for the borders. As
+         *          these textures are filled with a single color they are stretched to the
+         *          size of each part of the borders when drawn so they can be very small.
+         * @return - the size of the source textures for the borders.
+         */
+        static
+        utils::Sizef
+        getBorderSourceSize() noexcept;
+
         /**
          * @brief - Used to perform the loading of the borders to update the internal attributes.
-         *          Note that the locker is assumed to already be acquired. The textures are not
-         *          checked to determine whether we actually need a repaint.
+         *          Note that the locker is assumed to already be acquired. The textures are only
+         *          fetched again if the colors of the borders changed: they do not depend on the
+         *          size of the button.
          */
         void
         loadBorders();
 
         /**
-         * @brief - Clears the textures representing the border of this button.
+         * @brief - Releases the textures representing the border of this button.
          */
         void
         clearBorders();
 
+        /**
+         * @brief - Used to build the key identifying the shared texture of a border with
+         *          the specified color role in the current palette.
+         * @param role - the color role of the border.
+         * @return - the key of the shared texture.
+         */
+        std::string
+        getBorderKey(const core::engine::Palette::ColorRole& role);
+
+        /**
+         * @brief - Used to retrieve the shared texture representing a border with the
+         *          specified color role in the current palette.
+         * @param role - the color role of the border.
+         * @param key - the key of the shared texture as returned by `getBorderKey`.
+         * @return - the identifier of the shared texture.
+         */
+        utils::Uuid
+        acquireBorder(const core::engine::Palette::ColorRole& role,
+                      const std::string& key);
+
         /**
          * @brief - Used whenever a meaningful mouse button release event is detected. We want to
          *          toggle the button if needed and update the borders so that they are accurately
@@ -234,13 +265,15 @@ namespace sdl {
 
         /**
          * @brief - Convenience structure describing the internal properties to use to represent
-         *          the borders for this button.
+         *          the borders for this button. The textures are shared with all the buttons
+         *          using the same colors (see `SharedTextures`) and are identified by the keys.
          */
         struct BordersData {
-          utils::Uuid hLightBorder;
-          utils::Uuid hDarkBorder;
-          utils::Uuid vLightBorder;
-          utils::Uuid vDarkBorder;
+          utils::Uuid light;
+          utils::Uuid dark;
+
+          std::string lightKey;
+          std::string darkKey;
 
           float size;
 
@@ -2,6 +2,7 @@
 # define   BUTTON_HXX
 
 # include "Button.hh"
+# include "SharedTextures.hh"
 
 namespace sdl {
   namespace graphic {
@@ -236,84 +237,79 @@ namespace sdl {
       requestRepaint();
     }
 
+    inline
+    utils::Sizef
+    Button::getBorderSourceSize() noexcept {
+      return utils::Sizef(1.0f, 1.0f);
+    }
+
     inline
     void
     Button::loadBorders() {
-      // Clear existing borders.
-      clearBorders();
-
-      utils::Boxf area = LayoutItem::getRenderingArea();
+      // The borders only depend on the colors of the palette: if they did not
+      // change we can keep the current textures.
+      const std::string lightKey = getBorderKey(getBorderColorRole());
+      const std::string darkKey = getBorderKey(getBorderAlternateColorRole());
 
-      m_borders.hLightBorder = getEngine().createTexture(
-        utils::Sizef(area.w(), m_borders.size),
-        getBorderColorRole()
-      );
-      if (!m_borders.hLightBorder.valid()) {
-        error(
-          std::string("Unable to create border for button"),
-          std::string("Horizontal border not valid")
-        );
+      if (m_borders.light.valid() && m_borders.dark.valid() &&
+          m_borders.lightKey == lightKey && m_borders.darkKey == darkKey)
+      {
+        return;
       }
 
-      m_borders.hDarkBorder = getEngine().createTexture(
-        utils::Sizef(area.w(), m_borders.size),
-        getBorderAlternateColorRole()
-      );
-      if (!m_borders.hDarkBorder.valid()) {
-        error(
-          std::string("Unable to create border for button"),
-          std::string("Horizontal border not valid")
-        );
-      }
+      // Release existing borders.
+      clearBorders();
 
-      m_borders.vLightBorder = getEngine().createTexture(
-        utils::Sizef(m_borders.size, area.h()),
-        getBorderColorRole()
-      );
-      if (!m_borders.vLightBorder.valid()) {
+      m_borders.light = acquireBorder(getBorderColorRole(), lightKey);
+      if (!m_borders.light.valid()) {
         error(
           std::string("Unable to create border for button"),
-          std::string("Vertical border not valid")
+          std::string("Light border not valid")
         );
       }
 
-      m_borders.vDarkBorder = getEngine().createTexture(
-        utils::Sizef(m_borders.size, area.h()),
-        getBorderAlternateColorRole()
-      );
-      if (!m_borders.vDarkBorder.valid()) {
+      m_borders.dark = acquireBorder(getBorderAlternateColorRole(), darkKey);
+      if (!m_borders.dark.valid()) {
         error(
           std::string("Unable to create border for button"),
-          std::string("Vertical border not valid")
+          std::string("Dark border not valid")
         );
       }
 
-      getEngine().fillTexture(m_borders.hLightBorder, getPalette());
-      getEngine().fillTexture(m_borders.hDarkBorder, getPalette());
-      getEngine().fillTexture(m_borders.vLightBorder, getPalette());
-      getEngine().fillTexture(m_borders.vDarkBorder, getPalette());
+      m_borders.lightKey = lightKey;
+      m_borders.darkKey = darkKey;
     }
 
     inline
     void
     Button::clearBorders() {
-      if (m_borders.hLightBorder.valid()) {
-        getEngine().destroyTexture(m_borders.hLightBorder);
-        m_borders.hLightBorder.invalidate();
-      }
-      if (m_borders.hDarkBorder.valid()) {
-        getEngine().destroyTexture(m_borders.hDarkBorder);
-        m_borders.hDarkBorder.invalidate();
-      }
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_borders.light, m_borders.lightKey);
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_borders.dark, m_borders.darkKey);
+    }
 
-      if (m_borders.vLightBorder.valid()) {
-        getEngine().destroyTexture(m_borders.vLightBorder);
-        m_borders.vLightBorder.invalidate();
-      }
-      if (m_borders.vDarkBorder.valid()) {
-        getEngine().destroyTexture(m_borders.vDarkBorder);
-        m_borders.vDarkBorder.invalidate();
-      }
+    inline
+    std::string
+    Button::getBorderKey(const core::engine::Palette::ColorRole& role) {
+      return std::string("button_border_") + SharedTextures::keyFromColor(getPalette().getColorForRole(role));
+    }
+
+    inline
+    utils::Uuid
+    Button::acquireBorder(const core::engine::Palette::ColorRole& role,
+                          const std::string& key)
+    {
+      return SharedTextures::getInstance().acquire(
+        getEngine(),
+        key,
+        [this, &role]() {
+          utils::Uuid tex = getEngine().createTexture(getBorderSourceSize(), role);
+          if (tex.valid()) {
+            getEngine().fillTexture(tex, getPalette());
+          }
+
+          return tex;
+        }
+      );
     }
 
     inline
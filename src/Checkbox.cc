@@ -22,7 +22,9 @@ namespace sdl {
       m_toggled(checked),
 
       m_emptyBox(),
-      m_selectionItem()
+      m_emptyBoxKey(),
+      m_selectionItem(),
+      m_selectionItemKey()
     {
       build(TextData{text, font, size});
     }
@@ -193,7 +193,7 @@ namespace sdl {
         loadBox();
 
         /**
-         * @brief - Clears the textures representing the selection box of this item.
+         * @brief - Releases the textures representing the selection box of this item.
          */
         void
         clearBox();
@@ -228,14 +228,18 @@ namespace sdl {
          * @brief - The selection box' data for this item. Used to represent the box
          *          for the selection of the checkbox. This item will receive the
          *          selection's item when the box is toggled.
+         *          The texture is shared with the checkboxes having the same size and
+         *          colors and identified by the key.
          */
         utils::Uuid m_emptyBox;
+        std::string m_emptyBoxKey;
 
         /**
          * @brief - The selection's item data for this item. Used only when the checkbox
-         *          is toggled.
+         *          is toggled. Shared similarly to `m_emptyBox`.
          */
         utils::Uuid m_selectionItem;
+        std::string m_selectionItemKey;
     };
 
     using CheckboxShPtr = std::shared_ptr<Checkbox>;
@@ -2,6 +2,7 @@
 # define   CHECKBOX_HXX
 
 # include "Checkbox.hh"
+# include "SharedTextures.hh"
 
 namespace sdl {
   namespace graphic {
@@ -186,39 +187,39 @@ namespace sdl {
     inline
     void
     Checkbox::loadBox() {
-      // Clear existing selection box' data.
-      clearBox();
-
       // We need to create a box with the dimensions specified
       // by the virtual layout item. Whether we need to add the
       // selection mark depends on the state of this box.
-      // We will create two brushes to represent the two elems
-      // of the visual representation of the box.
+      // The two elems of the visual representation of the box
+      // only depend on their size and colors: they are shared
+      // with any other checkbox using the same ones.
       utils::Sizef boxSz = m_boxItem->getRenderingArea().toSize();
+      utils::Sizef togglingSz = getTogglingElementSize(boxSz);
 
       core::engine::Color c = getPalette().getBackgroundColor();
       core::engine::Color sbc = getContrastedColorFromRef(c);
       core::engine::Color sic = getContrastedColorFromRef(sbc);
 
-      // Create the background.
-      core::engine::BrushShPtr bBackground = std::make_shared<core::engine::Brush>(
-        std::string("bg_brush_for_") + getName(),
-        false
-      );
-      bBackground->setClearColor(sbc);
-      bBackground->create(boxSz, true);
+      const std::string bgKey = SharedTextures::keyFromBrush(sbc, boxSz);
+      const std::string fgKey = SharedTextures::keyFromBrush(sic, togglingSz);
+
+      if (m_emptyBox.valid() && m_selectionItem.valid() &&
+          m_emptyBoxKey == bgKey && m_selectionItemKey == fgKey)
+      {
+        return;
+      }
 
-      m_emptyBox = getEngine().createTextureFromBrush(bBackground);
+      // Acquire the new textures before releasing the existing
+      // ones so that textures still in use are not destroyed.
+      utils::Uuid emptyBox = SharedTextures::getInstance().acquireBrush(getEngine(), bgKey, sbc, boxSz);
+      utils::Uuid selectionItem = SharedTextures::getInstance().acquireBrush(getEngine(), fgKey, sic, togglingSz);
 
-      // Create the toggling element.
-      core::engine::BrushShPtr bForeground = std::make_shared<core::engine::Brush>(
-        std::string("fg_brush_for_") + getName(),
-        false
-      );
-      bForeground->setClearColor(sic);
-      bForeground->create(getTogglingElementSize(boxSz), true);
+      clearBox();
 
-      m_selectionItem = getEngine().createTextureFromBrush(bForeground);
+      m_emptyBox = emptyBox;
+      m_emptyBoxKey = bgKey;
+      m_selectionItem = selectionItem;
+      m_selectionItemKey = fgKey;
 
       if (!m_emptyBox.valid()) {
         error(
@@ -237,14 +238,8 @@ namespace sdl {
     inline
     void
     Checkbox::clearBox() {
-      if (m_emptyBox.valid()) {
-        getEngine().destroyTexture(m_emptyBox);
-        m_emptyBox.invalidate();
-      }
-      if (m_selectionItem.valid()) {
-        getEngine().destroyTexture(m_selectionItem);
-        m_selectionItem.invalidate();
-      }
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_emptyBox, m_emptyBoxKey);
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_selectionItem, m_selectionItemKey);
     }
 
   }
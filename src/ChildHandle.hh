@@ -0,0 +1,85 @@
+#ifndef    CHILD_HANDLE_HH
+# define   CHILD_HANDLE_HH
+
+# include <string>
+# include <sdl_core/SdlWidget.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Typed reference to one of the internal children of a widget. The handle is
+     *          resolved once when the child is created (or assigned) so that the parent can
+     *          access it without searching its children by name each time, which typically
+     *          happens when processing mouse or focus events.
+     *          The children are owned by their parent and the parent is responsible to `reset`
+     *          the handle when it removes the child from its hierarchy. As children which are
+     *          provided by the user can still be deleted externally the handle also keeps the
+     *          name of the child: the parent should verify that it is still registered (using
+     *          `hasChild`) before dereferencing such a handle.
+     */
+    template <typename Widget>
+    class ChildHandle {
+      public:
+
+        ChildHandle() noexcept;
+
+        explicit
+        ChildHandle(Widget* child);
+
+        ~ChildHandle() = default;
+
+        /**
+         * @brief - Used to assign a new child to this handle.
+         * @param child - the new child referenced by the handle, `null` to clear it.
+         */
+        void
+        reset(Widget* child = nullptr);
+
+        /**
+         * @brief - Whether this handle references a child.
+         * @return - `true` if a child is referenced.
+         */
+        bool
+        valid() const noexcept;
+
+        /**
+         * @brief - Retrieves the name of the child referenced by this handle as it was
+         *          when the handle was assigned. This can be used to verify that the
+         *          child still exists without dereferencing the handle.
+         * @return - the name of the child or an empty string if the handle is not valid.
+         */
+        const std::string&
+        getName() const noexcept;
+
+        /**
+         * @brief - Retrieves the child referenced by this handle.
+         * @return - the child, might be `null` if the handle is not valid.
+         */
+        Widget*
+        get() const noexcept;
+
+        Widget*
+        operator->() const noexcept;
+
+        /**
+         * @brief - Used to determine whether the input object is the child referenced by
+         *          this handle. Typically used to compare the emitter of an event.
+         * @param object - the object to compare.
+         * @return - `true` if the handle is valid and references the `object`.
+         */
+        bool
+        is(const core::engine::EngineObject* object) const noexcept;
+
+      private:
+
+        Widget* m_child;
+        std::string m_name;
+    };
+
+  }
+}
+
+# include "ChildHandle.hxx"
+
+#endif    /* CHILD_HANDLE_HH */
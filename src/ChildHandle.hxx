@@ -0,0 +1,73 @@
+#ifndef    CHILD_HANDLE_HXX
+# define   CHILD_HANDLE_HXX
+
+# include "ChildHandle.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    template <typename Widget>
+    inline
+    ChildHandle<Widget>::ChildHandle() noexcept:
+      m_child(nullptr),
+      m_name()
+    {
+      // Nothing to do.
+    }
+
+    template <typename Widget>
+    inline
+    ChildHandle<Widget>::ChildHandle(Widget* child):
+      m_child(child),
+      m_name(child != nullptr ? child->getName() : std::string())
+    {
+      // Nothing to do.
+    }
+
+    template <typename Widget>
+    inline
+    void
+    ChildHandle<Widget>::reset(Widget* child) {
+      m_child = child;
+      m_name = (child != nullptr ? child->getName() : std::string());
+    }
+
+    template <typename Widget>
+    inline
+    bool
+    ChildHandle<Widget>::valid() const noexcept {
+      return m_child != nullptr;
+    }
+
+    template <typename Widget>
+    inline
+    const std::string&
+    ChildHandle<Widget>::getName() const noexcept {
+      return m_name;
+    }
+
+    template <typename Widget>
+    inline
+    Widget*
+    ChildHandle<Widget>::get() const noexcept {
+      return m_child;
+    }
+
+    template <typename Widget>
+    inline
+    Widget*
+    ChildHandle<Widget>::operator->() const noexcept {
+      return m_child;
+    }
+
+    template <typename Widget>
+    inline
+    bool
+    ChildHandle<Widget>::is(const core::engine::EngineObject* object) const noexcept {
+      return m_child != nullptr && object == m_child;
+    }
+
+  }
+}
+
+#endif    /* CHILD_HANDLE_HXX */
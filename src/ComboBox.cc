@@ -3,6 +3,8 @@
 # include "GridLayout.hh"
 # include "LabelWidget.hh"
 # include "PictureWidget.hh"
+# include <numeric>
+# include <algorithm>
 # include <core_utils/CoreException.hh>
 
 namespace sdl {
@@ -10,6 +12,8 @@ namespace sdl {
 
     const int ComboBox::sk_defaultZOrder(1);
 
+    const std::chrono::milliseconds ComboBox::sk_typeAheadDelay(1000);
+
     ComboBox::ComboBox(const std::string& name,
                        const InsertPolicy& policy,
                        core::SdlWidget* parent,
@@ -24,7 +28,16 @@ namespace sdl {
       m_closedBox(),
 
       m_activeItem(-1),
-      m_items()
+      m_items(),
+      m_sortedItems(),
+
+      m_typeAhead(),
+      m_lastTypeAhead(),
+
+      m_icon(),
+      m_text(),
+      m_itemsIcons(),
+      m_itemsTexts()
     {
       // Assign the z order for this widget: it should be drawn in front of other
       // regular widgets.
@@ -41,34 +54,88 @@ namespace sdl {
                          const std::string& text,
                          const std::string& icon)
     {
-      // Create a new item from the input data.
-      ComboBoxItem item = ComboBoxItem{text, icon};
+      // Insert the item and register it in the sorted index.
+      const int id = placeItem(index, text, icon);
+      indexItem(id);
 
-      // Check the position of insertion: we want to correctly handle
-      // cases where the index is either negative or larger than the
-      // current size of the internal `m_items` vector.
-      if (index < 0) {
-        m_items.insert(m_items.cbegin(), item);
+      // Check whether we need to modify the display for this combobox. This
+      // can only be the case if the combobox is dropped, in which case the
+      // new item will be displayed. Otherwise nothing changes in the combobox
+      // so we can skip the update part.
+      if (isDropped()) {
+        requestRepaint();
       }
-      else if (index >= getItemsCount()) {
-        m_items.push_back(item);
+    }
+
+    void
+    ComboBox::insertItems(const std::vector<Entry>& entries) {
+      if (entries.empty()) {
+        return;
       }
-      else {
-        m_items.insert(m_items.cbegin() + index, item);
+
+      if (m_insertPolicy == InsertPolicy::InsertAlphabetically) {
+        // Each entry is inserted before the first existing item which comes
+        // after it: we can determine this anchor for all the entries based
+        // on the current items and then sort the entries sharing the same
+        // anchor. This allows to build the new list of items in one pass.
+        std::vector<std::pair<int, const Entry*>> added;
+        added.reserve(entries.size());
+
+        for (std::vector<Entry>::const_iterator it = entries.cbegin() ; it != entries.cend() ; ++it) {
+          added.push_back(std::make_pair(getAlphabeticalIndex(it->first), &(*it)));
+        }
+
+        std::stable_sort(
+          added.begin(),
+          added.end(),
+          [](const std::pair<int, const Entry*>& lhs, const std::pair<int, const Entry*>& rhs) {
+            return lhs.first < rhs.first || (lhs.first == rhs.first && lhs.second->first < rhs.second->first);
+          }
+        );
+
+        ItemsMap items;
+        items.reserve(m_items.size() + added.size());
+
+        int active = m_activeItem;
+        std::vector<std::pair<int, const Entry*>>::const_iterator toAdd = added.cbegin();
+
+        for (int id = 0 ; id <= getItemsCount() ; ++id) {
+          while (toAdd != added.cend() && toAdd->first == id) {
+            items.push_back(ComboBoxItem{toAdd->second->first, toAdd->second->second});
+            ++toAdd;
+          }
+
+          if (id == getItemsCount()) {
+            continue;
+          }
+
+          if (id == m_activeItem) {
+            active = static_cast<int>(items.size());
+          }
+
+          items.push_back(m_items[id]);
+        }
+
+        m_items.swap(items);
+        m_activeItem = active;
       }
+      else {
+        // Other policies depend on the items inserted before: we need to
+        // insert the entries one by one.
+        for (std::vector<Entry>::const_iterator it = entries.cbegin() ; it != entries.cend() ; ++it) {
+          const std::pair<int, bool> index = getIndexFromInsertPolicy(it->first);
 
-      // We also need to update the active item if any: indeed if the
-      // active item was after the item which has just been inserted
-      // we need to increase the value of the `m_activeItem` by one
-      // to make it for the newly inserted item.
-      if (hasActiveItem() && m_activeItem >= index) {
-        ++m_activeItem;
+          if (index.first >= 0 && index.first < getItemsCount() && index.second) {
+            eraseItem(index.first);
+          }
+
+          placeItem(index.first, it->first, it->second);
+        }
       }
 
-      // Check whether we need to modify the display for this combobox. This
-      // can only be the case if the combobox is dropped, in which case the
-      // new item will be displayed. Otherwise nothing changes in the combobox
-      // so we can skip the update part.
+      // The index is only built once all the items have been inserted.
+      rebuildSortedIndex();
+
       if (isDropped()) {
         requestRepaint();
       }
@@ -85,21 +152,8 @@ namespace sdl {
       }
 
       // Perform the deletion.
-      m_items.erase(m_items.cbegin() + index);
-
-      bool removedActive = false;
-
-      // Check whether this was the active item.
-      if (m_activeItem == index) {
-        // We need to make the next item active if it is still possible.
-        // The only way it can fail is if the active item was the last one
-        // on the list.
-        if (m_activeItem >= getItemsCount()) {
-          m_activeItem = getItemsCount() - 1;
-        }
-
-        removedActive = true;
-      }
+      unindexItem(index);
+      bool removedActive = eraseItem(index);
 
       // We need to update the content if needed. This can happen either is the
       // deleted item was the active one or if the combobox is dropped: in this
@@ -193,17 +247,12 @@ namespace sdl {
       // We can see that the focus reason needs to be clicked for
       // anything to happen in here so let's handle that first.
       if (e.getReason() == core::engine::FocusEvent::Reason::MouseFocus) {
-        // Retrieve the main icon and text widgets: both scenarii use
-        // them.
-        PictureWidget* icon = getChildAs<PictureWidget>(std::string("combobox_icon"));
-        LabelWidget* text = getChildAs<LabelWidget>(std::string("combobox_text"));
-
         // Check whether the combobox is closed: we will try to open the
         // combobox.
         if (isClosed()) {
           // If the emitter is either the icon or the text we can set the
           // state to `Dropped`.
-          if (e.isEmittedBy(icon) || e.isEmittedBy(text)) {
+          if (e.isEmittedBy(m_icon.get()) || e.isEmittedBy(m_text.get())) {
             // Set the state of this combobox to dropped.
             setState(State::Dropped);
 
@@ -219,10 +268,9 @@ namespace sdl {
         if (isDropped()) {
           // If the emitter is a child different from the main icon or text
           // but still one of the widget, we have a valid click so let's
-          // close the box.
-          core::SdlWidget* child = getChildOrNull<core::SdlWidget>(e.getEmitter()->getName());
-
-          if (child != icon && child != text && child != nullptr) {
+          // close the box. The only other children are the widgets used
+          // to display the items.
+          if (isItemWidget(e.getEmitter())) {
             // Set the state of this combobox to closed.
             setState(State::Closed);
           }
@@ -289,6 +337,46 @@ namespace sdl {
       return SdlWidget::resizeEvent(e);
     }
 
+    bool
+    ComboBox::keyPressEvent(const core::engine::KeyEvent& e) {
+      const bool toReturn = core::SdlWidget::keyPressEvent(e);
+
+      const bool erase = (e.getRawKey() == core::engine::RawKey::BackSpace);
+      if (!erase && !e.isPrintable()) {
+        return toReturn;
+      }
+
+      // Start a new search if the user stopped typing for too long.
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      if (now - m_lastTypeAhead > sk_typeAheadDelay) {
+        m_typeAhead.clear();
+      }
+      m_lastTypeAhead = now;
+
+      if (erase) {
+        if (!m_typeAhead.empty()) {
+          m_typeAhead.pop_back();
+        }
+      }
+      else {
+        m_typeAhead += e.getChar();
+      }
+
+      if (m_typeAhead.empty()) {
+        return toReturn;
+      }
+
+      const int id = findItemFromPrefix(m_typeAhead);
+
+      verbose("Type-ahead \"" + m_typeAhead + "\" matches item " + std::to_string(id));
+
+      if (id >= 0) {
+        setActiveItem(id);
+      }
+
+      return toReturn;
+    }
+
     bool
     ComboBox::filterMouseEvents(const core::engine::EngineObject* watched,
                                 const core::engine::MouseEventShPtr e) const noexcept
@@ -309,14 +397,10 @@ namespace sdl {
         return filtered;
       }
 
-      // Retrieve both the main icon and text.
-      PictureWidget* icon = getChildAs<PictureWidget>(std::string("combobox_icon"));
-      LabelWidget* text = getChildAs<LabelWidget>(std::string("combobox_text"));
-
-      // If the `watched` object is either of those, filter the event: we know
-      // that the event is already a mouse event so it's acceptable to filter
-      // out all these events.
-      if (watched == icon || watched == text) {
+      // If the `watched` object is either the main icon or text, filter the
+      // event: we know that the event is already a mouse event so it's
+      // acceptable to filter out all these events.
+      if (m_icon.is(watched) || m_text.is(watched)) {
         return true;
       }
 
@@ -362,32 +446,15 @@ namespace sdl {
       // Add these items to the layout.
       layout->addItem(icon, 0, 0, 1, 1);
       layout->addItem(text, 1, 0, 1, 1);
+
+      // Keep track of these children so that we don't need to look them up
+      // when processing events.
+      m_icon.reset(icon);
+      m_text.reset(text);
     }
 
     std::pair<int, bool>
     ComboBox::getIndexFromInsertPolicy(const std::string& text) const {
-      // Compute the alphabetical position of the input text based on the
-      // existing items already registered in the combobox.
-      // We could retrieve all the keys, add the input `text` then perform
-      // a sort and obtain the id. But we can also just scan all the
-      // existing keys and compare each one to the input `text` and work
-      // out the position of the text from there.
-      int alphabeticalRank = getItemsCount();
-      for (unsigned id = 0u ; id < m_items.size() ; ++id) {
-        if (m_items[id].text.compare(text) < 0) {
-          // The new text should be inserted at least before this item.
-          alphabeticalRank = id - 1;
-        }
-      }
-
-      // We only need to take care of the case where the input `text` should
-      // be inserted before the first registered item. We will end up with an
-      // `alphabeticalRank` of `-1` which we should transform into `0`. This
-      // is not a problem because the `AlphabeticalOrder` does not erase any
-      // existing item.
-      alphabeticalRank = std::max(alphabeticalRank, 0);
-
-
       // Disitnguish according to the insertion policy.
       switch (m_insertPolicy) {
         case InsertPolicy::InsertAtTop:
@@ -401,7 +468,7 @@ namespace sdl {
         case InsertPolicy::InsertBeforeCurrent:
           return std::make_pair(getActiveItem(), false);
         case InsertPolicy::InsertAlphabetically:
-          return std::make_pair(alphabeticalRank, false);
+          return std::make_pair(getAlphabeticalIndex(text), false);
         case InsertPolicy::NoInsert:
         default:
           break;
@@ -418,6 +485,159 @@ namespace sdl {
       return std::make_pair(0, false);
     }
 
+    int
+    ComboBox::getAlphabeticalIndex(const std::string& text) const noexcept {
+      // Find the first item which comes after the `text`: the new item should
+      // be inserted right before it. If there is none, it goes at the end.
+      SortedIndex::const_iterator it = std::upper_bound(
+        m_sortedItems.cbegin(),
+        m_sortedItems.cend(),
+        text,
+        [this](const std::string& t, int id) {
+          return t < m_items[id].text;
+        }
+      );
+
+      if (it == m_sortedItems.cend()) {
+        return getItemsCount();
+      }
+
+      return *it;
+    }
+
+    int
+    ComboBox::findItemFromPrefix(const std::string& prefix) const noexcept {
+      // Items starting with the prefix come right after it in alphabetical
+      // order: only the first item not before the prefix can match.
+      SortedIndex::const_iterator it = std::lower_bound(
+        m_sortedItems.cbegin(),
+        m_sortedItems.cend(),
+        prefix,
+        [this](int id, const std::string& p) {
+          return m_items[id].text < p;
+        }
+      );
+
+      if (it == m_sortedItems.cend() || m_items[*it].text.compare(0u, prefix.size(), prefix) != 0) {
+        return -1;
+      }
+
+      return *it;
+    }
+
+    int
+    ComboBox::placeItem(int index,
+                        const std::string& text,
+                        const std::string& icon)
+    {
+      // Clamp the position of insertion: we want to correctly handle
+      // cases where the index is either negative or larger than the
+      // current size of the internal `m_items` vector.
+      index = std::min(std::max(index, 0), getItemsCount());
+
+      m_items.insert(m_items.cbegin() + index, ComboBoxItem{text, icon});
+
+      // We also need to update the active item if any: indeed if the
+      // active item was after the item which has just been inserted
+      // we need to increase the value of the `m_activeItem` by one
+      // to make it for the newly inserted item.
+      if (hasActiveItem() && m_activeItem >= index) {
+        ++m_activeItem;
+      }
+
+      return index;
+    }
+
+    bool
+    ComboBox::eraseItem(int index) {
+      m_items.erase(m_items.cbegin() + index);
+
+      // Check whether this was the active item.
+      if (m_activeItem == index) {
+        // We need to make the next item active if it is still possible.
+        // The only way it can fail is if the active item was the last one
+        // on the list.
+        if (m_activeItem >= getItemsCount()) {
+          m_activeItem = getItemsCount() - 1;
+        }
+
+        return true;
+      }
+
+      // Keep the active item pointing to the same item.
+      if (hasActiveItem() && m_activeItem > index) {
+        --m_activeItem;
+      }
+
+      return false;
+    }
+
+    void
+    ComboBox::indexItem(int index) {
+      // Items located after the inserted one moved back by one.
+      for (SortedIndex::iterator it = m_sortedItems.begin() ; it != m_sortedItems.end() ; ++it) {
+        if (*it >= index) {
+          ++(*it);
+        }
+      }
+
+      SortedIndex::const_iterator pos = std::lower_bound(
+        m_sortedItems.cbegin(),
+        m_sortedItems.cend(),
+        index,
+        [this](int lhs, int rhs) {
+          return isBefore(lhs, rhs);
+        }
+      );
+
+      m_sortedItems.insert(pos, index);
+    }
+
+    void
+    ComboBox::unindexItem(int index) {
+      SortedIndex::const_iterator pos = std::lower_bound(
+        m_sortedItems.cbegin(),
+        m_sortedItems.cend(),
+        index,
+        [this](int lhs, int rhs) {
+          return isBefore(lhs, rhs);
+        }
+      );
+
+      if (pos != m_sortedItems.cend() && *pos == index) {
+        m_sortedItems.erase(pos);
+      }
+
+      // Items located after the removed one will move forward by one.
+      for (SortedIndex::iterator it = m_sortedItems.begin() ; it != m_sortedItems.end() ; ++it) {
+        if (*it > index) {
+          --(*it);
+        }
+      }
+    }
+
+    void
+    ComboBox::rebuildSortedIndex() {
+      m_sortedItems.resize(m_items.size());
+      std::iota(m_sortedItems.begin(), m_sortedItems.end(), 0);
+
+      std::sort(
+        m_sortedItems.begin(),
+        m_sortedItems.end(),
+        [this](int lhs, int rhs) {
+          return isBefore(lhs, rhs);
+        }
+      );
+    }
+
+    bool
+    ComboBox::isBefore(int lhs,
+                       int rhs) const noexcept
+    {
+      const int comp = m_items[lhs].text.compare(m_items[rhs].text);
+      return comp < 0 || (comp == 0 && lhs < rhs);
+    }
+
     void
     ComboBox::setActiveItem(int index) {
       // Remove the corresponding item if it exists.
@@ -439,8 +659,8 @@ namespace sdl {
 
       // We need to activate the corresponding text and icon from the internal
       // table.
-      getChildAs<PictureWidget>(std::string("combobox_icon"))->setImagePath(m_items[m_activeItem].icon);
-      getChildAs<LabelWidget>(std::string("combobox_text"))->setText(m_items[m_activeItem].text);
+      m_icon->setImagePath(m_items[m_activeItem].icon);
+      m_text->setText(m_items[m_activeItem].text);
     }
 
     void
@@ -483,9 +703,14 @@ namespace sdl {
       const int count = getVisibleItemsCount();
       const bool visible = (m_state == State::Dropped);
 
+      if (static_cast<int>(m_itemsIcons.size()) < count) {
+        m_itemsIcons.resize(count);
+        m_itemsTexts.resize(count);
+      }
+
       for (int id = 0 ; id < count ; ++id) {
         // Try to set the icon and the visible status for the picture widget.
-        PictureWidget* icon = getChildOrNull<PictureWidget>(getIconNameFromID(id));
+        PictureWidget* icon = m_itemsIcons[id].get();
 
         if (icon == nullptr) {
           // Create the item.
@@ -503,6 +728,8 @@ namespace sdl {
           // Register the click on the icon widget so that we can update the
           // selected element in this combobox.
           icon->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
+
+          m_itemsIcons[id].reset(icon);
         }
 
         // Now we either created the icon widget if needed or found it if it
@@ -511,7 +738,7 @@ namespace sdl {
         icon->setVisible(visible);
 
         // Try to set the text and the visible status for the label widget.
-        LabelWidget* text = getChildOrNull<LabelWidget>(getTextNameFromID(id));
+        LabelWidget* text = m_itemsTexts[id].get();
 
         if (text == nullptr) {
           // Create the item.
@@ -532,6 +759,8 @@ namespace sdl {
           // Register the click on the icon widget so that we can update the
           // selected element in this combobox.
           text->onClick.connect_member<ComboBox>(this, &ComboBox::onElementClicked);
+
+          m_itemsTexts[id].reset(text);
         }
 
         // Now we either created the label widget if needed or found it if it
@@ -563,6 +792,17 @@ namespace sdl {
       );
     }
 
+    bool
+    ComboBox::isItemWidget(const core::engine::EngineObject* object) const noexcept {
+      for (unsigned id = 0u ; id < m_itemsIcons.size() ; ++id) {
+        if (m_itemsIcons[id].is(object) || m_itemsTexts[id].is(object)) {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
     void
     ComboBox::onElementClicked(const std::string& name) {
       // Retrieve the index of the element based on the name of the widget
@@ -1,9 +1,14 @@
 #ifndef    COMBO_BOX_HH
 # define   COMBO_BOX_HH
 
+# include <chrono>
 # include <memory>
 # include <vector>
+# include <utility>
 # include <sdl_core/SdlWidget.hh>
+# include "ChildHandle.hh"
+# include "LabelWidget.hh"
+# include "PictureWidget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -29,6 +34,12 @@ namespace sdl {
         std::string
         getNameFromPolicy(const InsertPolicy& policy) noexcept;
 
+        /**
+         * @brief - Convenience define describing an entry to insert in the combobox: the
+         *          first element is the text and the second one the path to the icon.
+         */
+        using Entry = std::pair<std::string, std::string>;
+
       public:
 
         ComboBox(const std::string& name,
@@ -86,6 +97,18 @@ namespace sdl {
                    const std::string& text,
                    const std::string& icon = std::string());
 
+        /**
+         * @brief - Inserts all the provided `entries` in this combobox using the internal
+         *          `InsertPolicy`. The result is the same as calling `insertItem` for each
+         *          entry in order but the combobox is only updated once. When the policy is
+         *          to insert items alphabetically the entries are sorted beforehand and then
+         *          merged with the existing items.
+         *          Note that if the `InsertPolicy` does not allow insertion, an error is raised.
+         * @param entries - the texts and icons to insert.
+         */
+        void
+        insertItems(const std::vector<Entry>& entries);
+
         void
         removeItem(int index);
 
@@ -128,6 +151,18 @@ namespace sdl {
         bool
         resizeEvent(core::engine::ResizeEvent& e) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to provide type-ahead
+         *          search: printable characters are appended to a search prefix and the
+         *          first item (in alphabetical order) starting with this prefix becomes
+         *          active. The prefix is reset when the user does not type anything for
+         *          a while and `BackSpace` removes its last character.
+         * @param e - the key event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        keyPressEvent(const core::engine::KeyEvent& e) override;
+
         /**
          * @brief - Reimplementation of the base `SdlWidget` method to provide custom behavior
          *          upon clicking on the main icon and text element when the combobox has a
@@ -191,6 +226,84 @@ namespace sdl {
         std::pair<int, bool>
         getIndexFromInsertPolicy(const std::string& text) const;
 
+        /**
+         * @brief - Used to determine the index at which the `text` should be inserted so that
+         *          the items stay sorted alphabetically: this is the position of the first item
+         *          which comes after the `text`. The search uses the `m_sortedItems` so it runs
+         *          in logarithmic time.
+         * @param text - the text to insert in this combobox.
+         * @return - the index at which the text should be inserted.
+         */
+        int
+        getAlphabeticalIndex(const std::string& text) const noexcept;
+
+        /**
+         * @brief - Used to find the first item in alphabetical order which text starts with
+         *          the `prefix`. The search is a binary search in the `m_sortedItems`.
+         * @param prefix - the prefix to search for.
+         * @return - the index of the item or `-1` if no item starts with the prefix.
+         */
+        int
+        findItemFromPrefix(const std::string& prefix) const noexcept;
+
+        /**
+         * @brief - Inserts the item at `index` in the internal list and updates the active
+         *          item. The `m_sortedItems` is not updated.
+         * @param index - the index at which the item should be inserted, clamped to the
+         *                valid range.
+         * @param text - the text of the item.
+         * @param icon - the icon of the item.
+         * @return - the index at which the item was actually inserted.
+         */
+        int
+        placeItem(int index,
+                  const std::string& text,
+                  const std::string& icon);
+
+        /**
+         * @brief - Removes the item at `index` from the internal list and updates the active
+         *          item. The `m_sortedItems` is not updated. No controls are performed to check
+         *          whether the `index` is valid.
+         * @param index - the index of the item to remove.
+         * @return - `true` if the removed item was the active one.
+         */
+        bool
+        eraseItem(int index);
+
+        /**
+         * @brief - Registers the item at `index` in the `m_sortedItems`. The indices of the items
+         *          located after it are updated.
+         * @param index - the index of the item which has been inserted.
+         */
+        void
+        indexItem(int index);
+
+        /**
+         * @brief - Removes the item at `index` from the `m_sortedItems`. The indices of the items
+         *          located after it are updated.
+         * @param index - the index of the item which will be removed.
+         */
+        void
+        unindexItem(int index);
+
+        /**
+         * @brief - Sorts again all the items to fill the `m_sortedItems`. Used after a batch of
+         *          modifications.
+         */
+        void
+        rebuildSortedIndex();
+
+        /**
+         * @brief - Comparison used to order the `m_sortedItems`: items are sorted by text and
+         *          then by index.
+         * @param lhs - the index of the first item.
+         * @param rhs - the index of the second item.
+         * @return - `true` if `lhs` comes before `rhs`.
+         */
+        bool
+        isBefore(int lhs,
+                 int rhs) const noexcept;
+
         /**
          * @brief - Assign a new active item to the combobox. The item is checked against internal
          *          data to determine whether it actually exists and the corresponding display is
@@ -262,6 +375,15 @@ namespace sdl {
         std::string
         getTextNameFromID(int id) const noexcept;
 
+        /**
+         * @brief - Used to determine whether the input object is one of the widgets used
+         *          to display the items when the combobox is dropped.
+         * @param object - the object to check.
+         * @return - `true` if the object displays the icon or the text of an item.
+         */
+        bool
+        isItemWidget(const core::engine::EngineObject* object) const noexcept;
+
         /**
          * @brief - Used to connect this method as receiver of the elements inserted
          *          in the combobox so that we can update the widget displayed when
@@ -303,6 +425,8 @@ namespace sdl {
 
         using ItemsMap = std::vector<ComboBoxItem>;
 
+        using SortedIndex = std::vector<int>;
+
         /**
          * @brief - Convenience value describing the defautl z order to apply to combo boxes. This
          *          value is larger than the default one provided for widgets in general which is
@@ -310,6 +434,12 @@ namespace sdl {
          */
         static const int sk_defaultZOrder;
 
+        /**
+         * @brief - The time after which the type-ahead prefix is reset if the user did not
+         *          type any character.
+         */
+        static const std::chrono::milliseconds sk_typeAheadDelay;
+
         InsertPolicy m_insertPolicy;
         int m_maxVisibleItems;
 
@@ -329,6 +459,34 @@ namespace sdl {
 
         int m_activeItem;
         ItemsMap m_items;
+
+        /**
+         * @brief - The indices of the items of `m_items` sorted alphabetically by text. This
+         *          allows to find where a text lies among the items with a binary search.
+         */
+        SortedIndex m_sortedItems;
+
+        /**
+         * @brief - The prefix typed by the user to search for an item along with the time
+         *          of the last typed character.
+         */
+        std::string m_typeAhead;
+        std::chrono::steady_clock::time_point m_lastTypeAhead;
+
+        /**
+         * @brief - The children displaying the active item, resolved when building the
+         *          combobox.
+         */
+        ChildHandle<PictureWidget> m_icon;
+        ChildHandle<LabelWidget> m_text;
+
+        /**
+         * @brief - The children displaying the items when the combobox is dropped. They
+         *          are created the first time they are needed, the entry at index `id`
+         *          holds the widgets for the item `id`.
+         */
+        std::vector<ChildHandle<PictureWidget>> m_itemsIcons;
+        std::vector<ChildHandle<LabelWidget>> m_itemsTexts;
     };
 
     using ComboBoxShPtr = std::shared_ptr<ComboBox>;
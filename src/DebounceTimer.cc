@@ -0,0 +1,99 @@
+
+# include "DebounceTimer.hh"
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    DebounceTimer::DebounceTimer():
+      m_locker(),
+      m_waiter(),
+
+      m_deadlines(),
+
+      m_running(true),
+
+      m_thread()
+    {
+      // Nothing to do.
+    }
+
+    DebounceTimer::~DebounceTimer() {
+      {
+        const std::lock_guard guard(m_locker);
+        m_running = false;
+      }
+
+      m_waiter.notify_all();
+
+      if (m_thread.joinable()) {
+        m_thread.join();
+      }
+    }
+
+    void
+    DebounceTimer::schedule(const void* owner,
+                            std::chrono::steady_clock::time_point deadline,
+                            Callback callback)
+    {
+      const std::lock_guard guard(m_locker);
+
+      m_deadlines[owner] = Deadline{deadline, callback};
+
+      if (!m_thread.joinable()) {
+        m_thread = std::thread(&DebounceTimer::run, this);
+      }
+
+      // The new deadline might be earlier than the one the thread is waiting for.
+      m_waiter.notify_all();
+    }
+
+    void
+    DebounceTimer::run() {
+      std::unique_lock guard(m_locker);
+
+      while (m_running) {
+        // Sleep until someone schedules a deadline.
+        if (m_deadlines.empty()) {
+          m_waiter.wait(
+            guard,
+            [this]() {
+              return !m_running || !m_deadlines.empty();
+            }
+          );
+
+          continue;
+        }
+
+        // Wait for the earliest deadline. Deadlines might be scheduled or canceled
+        // in the meantime so we start over each time the thread wakes up.
+        std::chrono::steady_clock::time_point next = m_deadlines.cbegin()->second.time;
+        for (Deadlines::const_iterator it = m_deadlines.cbegin() ; it != m_deadlines.cend() ; ++it) {
+          next = std::min(next, it->second.time);
+        }
+
+        const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        if (now < next) {
+          m_waiter.wait_until(guard, next);
+          continue;
+        }
+
+        // Notify each owner whose deadline expired: the deadline is removed first
+        // so that the owner needs to schedule a new one to be notified again.
+        Deadlines::iterator it = m_deadlines.begin();
+        while (it != m_deadlines.end()) {
+          if (it->second.time > now) {
+            ++it;
+            continue;
+          }
+
+          Callback callback = it->second.callback;
+          it = m_deadlines.erase(it);
+
+          callback();
+        }
+      }
+    }
+
+  }
+}
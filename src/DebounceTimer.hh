@@ -0,0 +1,113 @@
+#ifndef    DEBOUNCE_TIMER_HH
+# define   DEBOUNCE_TIMER_HH
+
+# include <mutex>
+# include <chrono>
+# include <thread>
+# include <functional>
+# include <unordered_map>
+# include <condition_variable>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Timer shared by all the widgets needing to be woken up once after a
+     *          delay (typically text boxes notifying their value once the user has
+     *          stopped typing). Each owner can schedule a single deadline: scheduling
+     *          a new one replaces the previous one.
+     *          A single thread sleeps until the earliest deadline and notifies the
+     *          corresponding owner. When no deadline is scheduled the thread sleeps
+     *          until one comes in.
+     *          Callbacks are notified from the timer's thread while its internal lock
+     *          is held: they should only post events to their owner, and `schedule`
+     *          and `cancel` should not be called with a lock which is also acquired
+     *          by a callback.
+     */
+    class DebounceTimer {
+      public:
+
+        /**
+         * @brief - Callback notified once the deadline scheduled by its owner expires.
+         */
+        using Callback = std::function<void()>;
+
+        /**
+         * @brief - Retrieves the timer shared by the application. The thread of the
+         *          timer is only started upon scheduling the first deadline.
+         * @return - the shared debounce timer.
+         */
+        static
+        DebounceTimer&
+        getInstance();
+
+        ~DebounceTimer();
+
+        /**
+         * @brief - Registers the callback to notify once the `deadline` is reached. Any
+         *          deadline already scheduled for the same `owner` is replaced.
+         * @param owner - the element to which the deadline belongs.
+         * @param deadline - the time at which the callback should be notified.
+         * @param callback - the callback to notify.
+         */
+        void
+        schedule(const void* owner,
+                 std::chrono::steady_clock::time_point deadline,
+                 Callback callback);
+
+        /**
+         * @brief - Removes the deadline scheduled for the `owner` if any. Once this method
+         *          returns the callback is guaranteed not to be called anymore.
+         * @param owner - the element for which the deadline should be removed.
+         */
+        void
+        cancel(const void* owner);
+
+      private:
+
+        DebounceTimer();
+
+        /**
+         * @brief - The main loop of the timer's thread: waits for the earliest deadline
+         *          and notifies the corresponding owners until the timer is destroyed.
+         */
+        void
+        run();
+
+      private:
+
+        /**
+         * @brief - Convenience structure describing a deadline scheduled by an owner.
+         */
+        struct Deadline {
+          std::chrono::steady_clock::time_point time;
+          Callback callback;
+        };
+
+        using Deadlines = std::unordered_map<const void*, Deadline>;
+
+        /**
+         * @brief - Protects the scheduled deadlines. Held during the notification of
+         *          the callbacks.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - Used to wake up the timer's thread when a deadline is scheduled or
+         *          when the timer is destroyed.
+         */
+        std::condition_variable m_waiter;
+
+        Deadlines m_deadlines;
+
+        bool m_running;
+
+        std::thread m_thread;
+    };
+
+  }
+}
+
+# include "DebounceTimer.hxx"
+
+#endif    /* DEBOUNCE_TIMER_HH */
@@ -0,0 +1,26 @@
+#ifndef    DEBOUNCE_TIMER_HXX
+# define   DEBOUNCE_TIMER_HXX
+
+# include "DebounceTimer.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    DebounceTimer&
+    DebounceTimer::getInstance() {
+      static DebounceTimer timer;
+      return timer;
+    }
+
+    inline
+    void
+    DebounceTimer::cancel(const void* owner) {
+      const std::lock_guard guard(m_locker);
+      m_deadlines.erase(owner);
+    }
+
+  }
+}
+
+#endif    /* DEBOUNCE_TIMER_HXX */
@@ -0,0 +1,174 @@
+#ifndef    FIXED_GRID_LAYOUT_HH
+# define   FIXED_GRID_LAYOUT_HH
+
+# include <array>
+# include <memory>
+# include <sdl_core/Layout.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Grid layout which dimensions are known at compile time. Such grids are
+     *          commonly used internally to build composite widgets (scroll areas, etc.)
+     *          and never change their shape.
+     *          The information about lines and items is kept in arrays sized from the
+     *          template parameters so that no hash map or vector is needed to hold the
+     *          state of the layout and the loops over the lines have constant bounds.
+     *          The solver follows the semantics of the `GridLayout` for single-cell
+     *          items: lines are allocated a fair share of the space which is refined
+     *          based on the policies of the items, giving precedence to the items which
+     *          can expand. Each cell can hold at most one item and items cannot span
+     *          several cells.
+     */
+    template <unsigned Columns, unsigned Rows>
+    class FixedGridLayout: public core::Layout {
+      public:
+
+        static_assert(Columns > 0u, "Fixed grid layout should have at least one column");
+        static_assert(Rows > 0u, "Fixed grid layout should have at least one row");
+
+        FixedGridLayout(const std::string& name,
+                        core::SdlWidget* widget,
+                        float margin = 0.0f);
+
+        virtual ~FixedGridLayout();
+
+        /**
+         * @brief - Adds the `container` to this layout at the specified coordinates.
+         *          The coordinates are checked against the dimensions of the grid at
+         *          compile time. An error is raised if the cell is already used.
+         * @param container - the item to insert in the layout.
+         */
+        template <unsigned X, unsigned Y>
+        void
+        addItem(core::LayoutItem* container);
+
+        /**
+         * @brief - Reimplementation of the base `Layout` method which checks at runtime
+         *          that the item fits in a single free cell of the grid. An error is
+         *          raised if this is not the case.
+         * @param container - the item to insert in the layout.
+         * @param x - the column of the item.
+         * @param y - the row of the item.
+         * @param w - the number of columns spanned by the item, should be `1`.
+         * @param h - the number of rows spanned by the item, should be `1`.
+         */
+        void
+        addItem(core::LayoutItem* container,
+                unsigned x,
+                unsigned y,
+                unsigned w,
+                unsigned h) override;
+
+        template <unsigned Column>
+        void
+        setColumnMinimumWidth(float width);
+
+        template <unsigned Row>
+        void
+        setRowMinimumHeight(float height);
+
+      protected:
+
+        void
+        computeGeometry(const utils::Boxf& area) override;
+
+        /**
+         * @brief - Reimplementation of the base `Layout` method to provide update of the
+         *          internal locations of the items.
+         * @param logicID - the logical id which has just been removed.
+         * @param physID - the physical id which has just been removed.
+         * @return - true as this layout always needs a rebuild when an item is removed.
+         */
+        bool
+        onIndexRemoved(int logicID,
+                       int physID) override;
+
+      private:
+
+        /**
+         * @brief - The maximum number of items which can be registered in the layout.
+         */
+        static constexpr unsigned sk_cells = Columns * Rows;
+
+        // Convenience record holding the information for a single column/row.
+        struct LineInfo {
+          float min;
+        };
+
+        // Convenience record holding the position of an item in the layout. The
+        // `item` is `null` for unused entries.
+        struct ItemInfo {
+          unsigned x, y;
+          core::LayoutItem* item;
+        };
+
+        using Locations = std::array<ItemInfo, sk_cells>;
+
+        /**
+         * @brief - Raises the minimum size of the items so that they respect the minimum
+         *          dimensions of their column and row, as long as it does not conflict
+         *          with their size hint and maximum size. This is the single-cell version
+         *          of the process performed by the `GridLayout`.
+         * @param items - the information about the items, updated by this method.
+         */
+        void
+        adjustItemsToConstraints(std::vector<WidgetInfo>& items) const noexcept;
+
+        /**
+         * @brief - Computes the dimension of each line of the layout along a direction.
+         *          When `Horizontal` is `true` the lines are the columns and the width
+         *          of the `boxes` is updated, otherwise the lines are the rows and their
+         *          height is updated.
+         * @param window - the available space for the layout.
+         * @param lines - the information about the lines to adjust.
+         * @param items - the information about the items of the layout.
+         * @param boxes - the box of each item, updated with the computed dimension.
+         * @return - the dimension of each line.
+         */
+        template <bool Horizontal, unsigned Lines>
+        std::array<float, Lines>
+        adjustLines(const utils::Sizef& window,
+                    const std::array<LineInfo, Lines>& lines,
+                    const std::vector<WidgetInfo>& items,
+                    std::array<utils::Boxf, sk_cells>& boxes) const;
+
+        /**
+         * @brief - Retrieves the index of the item located on the `line` at `position`
+         *          along the other direction.
+         * @param line - the index of the line.
+         * @param position - the index of the cell on the line.
+         * @return - the index of the item or `-1` if the cell is empty.
+         */
+        template <bool Horizontal>
+        int
+        getItemOnLine(unsigned line,
+                      unsigned position) const noexcept;
+
+      private:
+
+        std::array<LineInfo, Columns> m_columnsInfo;
+        std::array<LineInfo, Rows> m_rowsInfo;
+
+        /**
+         * @brief - The index of the item located in each cell of the grid (stored in
+         *          row-major order) or `-1` if the cell is empty.
+         */
+        std::array<int, sk_cells> m_cells;
+
+        /**
+         * @brief - The location of each item registered in the layout indexed by its
+         *          physical id.
+         */
+        Locations m_locations;
+    };
+
+    template <unsigned Columns, unsigned Rows>
+    using FixedGridLayoutShPtr = std::shared_ptr<FixedGridLayout<Columns, Rows>>;
+  }
+}
+
+# include "FixedGridLayout.hxx"
+
+#endif    /* FIXED_GRID_LAYOUT_HH */
@@ -0,0 +1,424 @@
+#ifndef    FIXED_GRID_LAYOUT_HXX
+# define   FIXED_GRID_LAYOUT_HXX
+
+# include "FixedGridLayout.hh"
+
+# include <algorithm>
+# include <sdl_core/SdlWidget.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    FixedGridLayout<Columns, Rows>::FixedGridLayout(const std::string& name,
+                                                    core::SdlWidget* widget,
+                                                    float margin):
+      core::Layout(name, widget, margin),
+
+      m_columnsInfo(),
+      m_rowsInfo(),
+
+      m_cells(),
+      m_locations()
+    {
+      m_columnsInfo.fill(LineInfo{0.0f});
+      m_rowsInfo.fill(LineInfo{0.0f});
+
+      m_cells.fill(-1);
+      m_locations.fill(ItemInfo{0u, 0u, nullptr});
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    FixedGridLayout<Columns, Rows>::~FixedGridLayout() {}
+
+    template <unsigned Columns, unsigned Rows>
+    template <unsigned X, unsigned Y>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::addItem(core::LayoutItem* container) {
+      static_assert(X < Columns, "Item should be located in an existing column");
+      static_assert(Y < Rows, "Item should be located in an existing row");
+
+      addItem(container, X, Y, 1u, 1u);
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::addItem(core::LayoutItem* container,
+                                            unsigned x,
+                                            unsigned y,
+                                            unsigned w,
+                                            unsigned h)
+    {
+      if (x >= Columns || y >= Rows || w != 1u || h != 1u) {
+        error(
+          std::string("Cannot add item at ") + std::to_string(x) + "x" + std::to_string(y) +
+          " in " + std::to_string(Columns) + "x" + std::to_string(Rows) + " fixed grid layout",
+          std::string("Items should occupy a single cell of the grid")
+        );
+      }
+
+      if (m_cells[y * Columns + x] >= 0) {
+        error(
+          std::string("Cannot add item at ") + std::to_string(x) + "x" + std::to_string(y) +
+          " in fixed grid layout",
+          std::string("Cell already used")
+        );
+      }
+
+      const int physID = core::Layout::addItem(container);
+
+      if (physID >= 0) {
+        m_locations[physID] = ItemInfo{x, y, container};
+        m_cells[y * Columns + x] = physID;
+      }
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    template <unsigned Column>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::setColumnMinimumWidth(float width) {
+      static_assert(Column < Columns, "Minimum width should be assigned to an existing column");
+
+      m_columnsInfo[Column].min = width;
+      makeGeometryDirty();
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    template <unsigned Row>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::setRowMinimumHeight(float height) {
+      static_assert(Row < Rows, "Minimum height should be assigned to an existing row");
+
+      m_rowsInfo[Row].min = height;
+      makeGeometryDirty();
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::computeGeometry(const utils::Boxf& window) {
+      // The process is the same as the one of the `GridLayout` restricted to
+      // single-cell items: the columns and rows are adjusted independently
+      // and items are then positioned and centered in their cell.
+      // Note that the information about the items and the output boxes are
+      // still provided through vectors as required by the base `Layout`.
+      const utils::Sizef internalSize = computeAvailableSize(window);
+
+      std::vector<WidgetInfo> itemsInfo = computeItemsInfo();
+
+      adjustItemsToConstraints(itemsInfo);
+
+      std::array<utils::Boxf, sk_cells> boxes;
+      boxes.fill(utils::Boxf());
+
+      const std::array<float, Columns> columnsDims = adjustLines<true, Columns>(internalSize, m_columnsInfo, itemsInfo, boxes);
+      const std::array<float, Rows> rowsDims = adjustLines<false, Rows>(internalSize, m_rowsInfo, itemsInfo, boxes);
+
+      // Position each item based on the dimensions of the lines before it and
+      // center it in its cell if it is smaller.
+      std::vector<utils::Boxf> outputBoxes(getItemsCount());
+
+      for (int index = 0 ; index < getItemsCount() ; ++index) {
+        const ItemInfo& loc = m_locations[index];
+
+        if (loc.item == nullptr) {
+          error(
+            std::string("Could not retrieve information for item \"") +
+            getItemAt(index)->getName() + "\" while updating fixed grid layout"
+          );
+        }
+
+        float xItem = getMargin().w();
+        float yItem = getMargin().h();
+
+        for (unsigned column = 0u ; column < loc.x ; ++column) {
+          xItem += columnsDims[column];
+        }
+        for (unsigned row = 0u ; row < loc.y ; ++row) {
+          yItem += rowsDims[row];
+        }
+
+        if (boxes[index].w() < columnsDims[loc.x]) {
+          xItem += ((columnsDims[loc.x] - boxes[index].w()) / 2.0f);
+        }
+        if (boxes[index].h() < rowsDims[loc.y]) {
+          yItem += ((rowsDims[loc.y] - boxes[index].h()) / 2.0f);
+        }
+
+        outputBoxes[index] = utils::Boxf(xItem, yItem, boxes[index].w(), boxes[index].h());
+      }
+
+      assignRenderingAreas(outputBoxes, window);
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    bool
+    FixedGridLayout<Columns, Rows>::onIndexRemoved(int /*logicID*/,
+                                                   int /*physID*/)
+    {
+      // Rebuild the locations from the items still registered in the layout:
+      // the ids of the items located after the removed one have changed.
+      Locations old = m_locations;
+
+      m_cells.fill(-1);
+      m_locations.fill(ItemInfo{0u, 0u, nullptr});
+
+      for (unsigned id = 0u ; id < sk_cells ; ++id) {
+        if (old[id].item == nullptr) {
+          continue;
+        }
+
+        const int newID = getIndexOf(old[id].item);
+
+        if (isValidIndex(newID)) {
+          m_locations[newID] = old[id];
+          m_cells[old[id].y * Columns + old[id].x] = newID;
+        }
+      }
+
+      return true;
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    inline
+    void
+    FixedGridLayout<Columns, Rows>::adjustItemsToConstraints(std::vector<WidgetInfo>& items) const noexcept {
+      // See `GridLayout::adjustItemToConstraints` for details: the minimum size
+      // of each item is raised to the minimum dimensions of its cell unless it
+      // conflicts with its size hint (and policy) or its maximum size.
+      for (unsigned item = 0u ; item < items.size() ; ++item) {
+        const ItemInfo& loc = m_locations[item];
+
+        utils::Sizef& min = items[item].min;
+        const utils::Sizef& hint = items[item].hint;
+        const utils::Sizef& max = items[item].max;
+        const core::SizePolicy& policy = items[item].policy;
+
+        float adjustedMinWidth = (min.isValid() ? min.w() : m_columnsInfo[loc.x].min);
+        float adjustedMinHeight = (min.isValid() ? min.h() : m_rowsInfo[loc.y].min);
+
+        if (hint.isValid()) {
+          if (adjustedMinWidth < hint.w()) {
+            adjustedMinWidth = hint.w();
+          }
+          if (hint.w() < adjustedMinWidth && !policy.canExtendHorizontally()) {
+            adjustedMinWidth = hint.w();
+          }
+
+          if (adjustedMinHeight < hint.h()) {
+            adjustedMinHeight = hint.h();
+          }
+          if (hint.h() < adjustedMinHeight && !policy.canExtendVertically()) {
+            adjustedMinHeight = hint.h();
+          }
+        }
+
+        if (max.isValid() && max.w() < adjustedMinWidth) {
+          adjustedMinWidth = max.w();
+        }
+        if (max.isValid() && max.h() < adjustedMinHeight) {
+          adjustedMinHeight = max.h();
+        }
+
+        min.w() = adjustedMinWidth;
+        min.h() = adjustedMinHeight;
+      }
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    template <bool Horizontal, unsigned Lines>
+    inline
+    std::array<float, Lines>
+    FixedGridLayout<Columns, Rows>::adjustLines(const utils::Sizef& window,
+                                                const std::array<LineInfo, Lines>& lines,
+                                                const std::vector<WidgetInfo>& items,
+                                                std::array<utils::Boxf, sk_cells>& boxes) const
+    {
+      // Number of cells on each line.
+      constexpr unsigned cells = (Horizontal ? Rows : Columns);
+
+      // Convenience accessors to the dimension handled by this method.
+      auto dim = [](auto& size) -> decltype(auto) {
+        if constexpr (Horizontal) {
+          return size.w();
+        }
+        else {
+          return size.h();
+        }
+      };
+
+      std::array<float, Lines> dims;
+      dims.fill(0.0f);
+
+      // Lines without visible items are assigned their minimum dimension and
+      // do not take part in the optimization process.
+      std::array<bool, Lines> populated;
+      populated.fill(false);
+
+      float spaceToUse = dim(window);
+
+      for (unsigned line = 0u ; line < Lines ; ++line) {
+        for (unsigned cell = 0u ; cell < cells ; ++cell) {
+          const int item = getItemOnLine<Horizontal>(line, cell);
+          if (item >= 0 && items[item].visible) {
+            populated[line] = true;
+          }
+        }
+
+        if (!populated[line]) {
+          dims[line] = lines[line].min;
+          spaceToUse -= dims[line];
+        }
+      }
+
+      // Iteratively allocate the remaining space fairly among the lines which
+      // can still be adjusted until all the space is used or no line can be
+      // modified anymore.
+      std::array<bool, Lines> adjustable = populated;
+      unsigned linesRemaining = static_cast<unsigned>(std::count(adjustable.cbegin(), adjustable.cend(), true));
+
+      bool allSpaceUsed = false;
+      float achieved = 0.0f;
+
+      while (linesRemaining > 0u && !allSpaceUsed) {
+        const float defaultDim = allocateFairly(spaceToUse, linesRemaining);
+
+        for (unsigned line = 0u ; line < Lines ; ++line) {
+          if (!adjustable[line]) {
+            continue;
+          }
+
+          for (unsigned cell = 0u ; cell < cells ; ++cell) {
+            const int item = getItemOnLine<Horizontal>(line, cell);
+            if (item < 0 || !items[item].visible) {
+              continue;
+            }
+
+            if constexpr (Horizontal) {
+              boxes[item].w() = computeWidthFromPolicy(boxes[item], defaultDim, items[item]);
+            }
+            else {
+              boxes[item].h() = computeHeightFromPolicy(boxes[item], defaultDim, items[item]);
+            }
+          }
+        }
+
+        // The dimension of a line is the one of its largest item.
+        achieved = 0.0f;
+
+        for (unsigned line = 0u ; line < Lines ; ++line) {
+          if (populated[line]) {
+            dims[line] = 0.0f;
+
+            for (unsigned cell = 0u ; cell < cells ; ++cell) {
+              const int item = getItemOnLine<Horizontal>(line, cell);
+              if (item >= 0 && items[item].visible) {
+                dims[line] = std::max(dims[line], dim(boxes[item]));
+              }
+            }
+          }
+
+          achieved += dims[line];
+        }
+
+        utils::Sizef achievedSize = window;
+        dim(achievedSize) = achieved;
+
+        if (achievedSize.compareWithTolerance(window, 1.0f)) {
+          allSpaceUsed = true;
+          continue;
+        }
+
+        const utils::Sizef adjustment = computeSpaceAdjustmentNeeded(achievedSize, window);
+        spaceToUse = dim(adjustment);
+
+        const core::SizePolicy action = shrinkOrGrow(window, achievedSize, 0.5f);
+
+        const bool grow = (Horizontal ? action.canExtendHorizontally() : action.canExtendVertically());
+        const bool shrink = (Horizontal ? action.canShrinkHorizontally() : action.canShrinkVertically());
+
+        // A line can grow as soon as one of its items can grow while all its
+        // items should be able to shrink (or be smaller than the line) for it
+        // to shrink. Lines with expanding items have precedence when growing.
+        std::array<bool, Lines> usable;
+        usable.fill(false);
+        std::array<bool, Lines> expanding;
+        expanding.fill(false);
+
+        bool expand = false;
+
+        for (unsigned line = 0u ; line < Lines ; ++line) {
+          if (!populated[line]) {
+            continue;
+          }
+
+          usable[line] = shrink && !grow;
+
+          for (unsigned cell = 0u ; cell < cells ; ++cell) {
+            const int item = getItemOnLine<Horizontal>(line, cell);
+            if (item < 0 || !items[item].visible) {
+              continue;
+            }
+
+            const bool canBeUsed = canBeUsedTo(items[item], boxes[item], action).first;
+
+            if (grow && canBeUsed) {
+              usable[line] = true;
+
+              const bool canExpand = (Horizontal ? items[item].policy.canExpandHorizontally() : items[item].policy.canExpandVertically());
+              expanding[line] = expanding[line] || canExpand;
+              expand = expand || canExpand;
+            }
+
+            if (!grow && shrink && !canBeUsed && dims[line] <= dim(boxes[item])) {
+              usable[line] = false;
+            }
+          }
+        }
+
+        linesRemaining = 0u;
+
+        for (unsigned line = 0u ; line < Lines ; ++line) {
+          adjustable[line] = usable[line] && (!expand || expanding[line]);
+          if (adjustable[line]) {
+            ++linesRemaining;
+          }
+        }
+      }
+
+      if (!allSpaceUsed) {
+        warn(
+          std::string("Could only achieve ") + (Horizontal ? "width" : "height") + " of " + std::to_string(achieved) +
+          " but available space is " + std::to_string(dim(window))
+        );
+      }
+
+      return dims;
+    }
+
+    template <unsigned Columns, unsigned Rows>
+    template <bool Horizontal>
+    inline
+    int
+    FixedGridLayout<Columns, Rows>::getItemOnLine(unsigned line,
+                                                  unsigned position) const noexcept
+    {
+      if constexpr (Horizontal) {
+        return m_cells[position * Columns + line];
+      }
+      else {
+        return m_cells[line * Columns + position];
+      }
+    }
+
+  }
+}
+
+#endif    /* FIXED_GRID_LAYOUT_HXX */
@@ -2,25 +2,39 @@
 # include "FloatValidator.hh"
 # include <cmath>
 # include <string>
-# include "Validator_utils.hxx"
 
 namespace sdl {
   namespace graphic {
 
     Validator::State
     FloatValidator::validate(const std::string& input) const {
+      return evaluate(number::parse(input));
+    }
+
+    Validator::ContextShPtr
+    FloatValidator::createContext() const {
+      return std::make_shared<NumberContext>();
+    }
+
+    void
+    FloatValidator::validateRange(const std::string_view* inputs,
+                                  std::size_t count,
+                                  State* states) const
+    {
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        states[id] = evaluate(number::parse(inputs[id]));
+      }
+    }
+
+    Validator::State
+    FloatValidator::evaluate(const number::Components& number) const {
       // Note: the actual implementation is based on what we found in the Qt repository
       // but refined in order to provide more precise analysis of intermediate and
       // invalid states. For more details, see here:
       // https://code.woboq.org/qt5/qtbase/src/gui/util/qvalidator.cpp.html.
-      // Try to convert the input string to a float value: if this cannot be done
-      // we have a trivial case of an invalid input.
-      bool ok = false;
-      float val = utils::convert(input, 0.0f, ok);
-
-      // Trivial case of the empty string which allows to safely access at least the
-      // first characters in later tests.
-      if (input.empty()) {
+
+      // Trivial case of the empty string.
+      if (number.size == 0u) {
         // Consider empty string as intermediate.
         return State::Intermediate;
       }
@@ -28,39 +42,41 @@ namespace sdl {
       // Check whether the input string has at least the right sign compared to the
       // range. In order to do that we want to check for the existence of the '-'
       // and '+' characters in the string.
-      if (m_lower >= 0 && input[0] == '-') {
+      if (m_lower >= 0 && number.sign == '-') {
         return State::Invalid;
       }
-      if (m_upper < 0 && input[0] == '+') {
+      if (m_upper < 0 && number.sign == '+') {
         return State::Invalid;
       }
 
       // We should detect cases where the notation is expected to be scientific and
       // when we have an invalid leading part (i.e. with more than `1` digit).
       if (m_notation == number::Notation::Scientific) {
-        // Retrieve the leading part of the number if any and compute its length.
-        int leading = 0;
-        bool hasLeading = false;
-        extractComponents(input, &leading, &hasLeading);
-        int digits = (std::abs(leading) == 0 ? 1 : static_cast<int>(std::log10(std::abs(leading)) + 1));
-
-        if (hasLeading && digits > 1) {
+        if (number.leadDigits > 0u && number::countDigits(number.lead) > 1) {
           return State::Invalid;
         }
       }
 
-      // Check whether the string is composed of a single '-' or '+' character: the
-      // conversion fails on this type of string but it is considered intermediate
-      // instead of `Invalid` so we need to check that before using the result of
-      // the `ok` value.
-      if ((input[0] == '-' || input[0] == '+') && input.size() == 1u) {
+      // Check whether the string is composed of a single '-' or '+' character: this
+      // is not a number yet but it is considered intermediate instead of `Invalid`.
+      if (number.sign != '\0' && number.size == 1u) {
+        return State::Intermediate;
+      }
+
+      // Any unexpected character makes the input invalid. On the other hand a number
+      // which is only missing some digits (e.g. "1e" or "-.") can still be completed
+      // and is thus intermediate.
+      if (number.invalid > 0u) {
+        return State::Invalid;
+      }
+      if (!number::isComplete(number)) {
         return State::Intermediate;
       }
 
-      // Now we can check if the conversion was successful: if this is not the case
-      // it means that something is wrong with the input string and thus we can say
-      // that's it's invalid in regard of the range.
-      if (!ok) {
+      // Now we can convert the number: if this fails it means that the value can't
+      // be represented and thus we can say that's it's invalid in regard of the range.
+      float val = 0.0f;
+      if (!number::toFloat(number, val)) {
         return State::Invalid;
       }
 
@@ -81,14 +97,14 @@ namespace sdl {
         case number::Notation::Standard:
           return validateStandardNotation(val, digits);
         case number::Notation::Scientific:
-          return validateScientificNotation(val, input);
+          return validateScientificNotation(val, number);
         default:
           break;
       }
 
       // Failure to interpret the number notation results in an error.
       error(
-        std::string("Could not validate input \"") + input + "\" as floating point value",
+        std::string("Could not validate input as floating point value"),
         std::string("Could not interpret number notation ") + std::to_string(static_cast<int>(m_notation))
       );
 
@@ -177,9 +193,9 @@ namespace sdl {
 
     Validator::State
     FloatValidator::validateScientificNotation(float value,
-                                               const std::string& digits) const noexcept
+                                               const number::Components& number) const noexcept
     {
-      // This method is supposedly called when the input `digits` string represents a number
+      // This method is supposedly called when the input `number` represents a number
       // in scientific notation. Upon entering this function we already know that the input
       // value is not valid so we should try to determine whether it is an intermediate or
       // an invalid input.
@@ -196,20 +212,14 @@ namespace sdl {
       accountForDecimals(lower, upper);
 
       // Determine whether there's already a decimal separator (a.k.a. '.' or ',' character)
-      // or/and an exponent by extracting each component of the input number.
-      // Extract each part of the input value.
-      int leading = 0, decimals = 0, exponent = 0;
-      bool hasLeading = false, hasDecimals = false, hasExponent = false;
-      extractComponents(digits, &leading, &hasLeading, &decimals, &hasDecimals, &exponent, &hasExponent);
+      // or/and an exponent from the components of the input number. Only the sign of the
+      // exponent matters for the analysis.
+      const bool hasExponent = number.exponent;
+      const int exponent = (number.exp == 0u ? 0 : (number.expSign == '-' ? -1 : 1));
 
       // We want to detect valuies which are clearly too big or too large and which cannot
       // be made valid by adding digits and decimal separator or exponent if possible.
-      int leadingDigits = (leading == 0 ? 1 : static_cast<int>(std::log10(std::abs(leading)) + 1));
-      int decDigits = (decimals == 0 ? 1 : static_cast<int>(std::log10(std::abs(decimals)) + 1));
-      int expDigits = (exponent == 0 ? 1 : static_cast<int>(std::log10(std::abs(exponent)) + 1));
-
-      debug("Number \"" + digits + " parsed to l: " + std::to_string(leading) + ", d: " + std::to_string(decimals) + ", e: " + std::to_string(exponent));
-      debug("Digits: (" + std::to_string(leadingDigits) + ", " + std::to_string(decDigits) + ", " + std::to_string(expDigits) + ")");
+      const int leadingDigits = number::countDigits(number.lead);
 
       // Number with more that one digit in the leading part are clearly invalid.
       if (leadingDigits > 1) {
@@ -79,6 +79,47 @@ namespace sdl {
         State
         validate(const std::string& input) const override;
 
+        /**
+         * @brief - Reimplementation of the base `Validator` method to provide a context
+         *          able to hold the components of the number being edited.
+         * @return - a new context suited for this validator.
+         */
+        ContextShPtr
+        createContext() const override;
+
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to validate values
+         *          directly from their views, without copying them.
+         * @param inputs - pointer to the first value to validate.
+         * @param count - the number of values to validate.
+         * @param states - pointer to the first state to fill.
+         */
+        void
+        validateRange(const std::string_view* inputs,
+                      std::size_t count,
+                      State* states) const override;
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to indicate that
+         *          the validation does not modify this validator and can thus be run
+         *          concurrently.
+         * @return - `true`.
+         */
+        bool
+        canValidateConcurrently() const noexcept override;
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to produce the verdict
+         *          for the number described by the input components given the range and
+         *          notation of this validator.
+         * @param number - the components of the number to validate.
+         * @return - a value among the enumeration to indicate the validity of the number.
+         */
+        State
+        evaluate(const number::Components& number) const override;
+
       private:
 
         /**
@@ -113,12 +154,12 @@ namespace sdl {
          *          scientific notation. Returns a state which allow to determine whether the value
          *          is valid given the range and decimals count.
          * @param value - the float value to validate against he internal range.
-         * @param digits - the initial string which produced the `value`.
+         * @param number - the components of the number which produced the `value`.
          * @return - a state describing the input `value` is valid against the internal range.
          */
         State
         validateScientificNotation(float value,
-                                   const std::string& digits) const noexcept;
+                                   const number::Components& number) const noexcept;
 
       private:
 
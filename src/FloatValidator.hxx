@@ -65,6 +65,12 @@ namespace sdl {
       }
     }
 
+    inline
+    bool
+    FloatValidator::canValidateConcurrently() const noexcept {
+      return true;
+    }
+
   }
 }
 
@@ -0,0 +1,154 @@
+#ifndef    GAP_BUFFER_HH
+# define   GAP_BUFFER_HH
+
+# include <string>
+# include <utility>
+# include <string_view>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Text storage organized as a gap buffer: the characters are kept in a
+     *          single contiguous buffer which contains an unused area (the gap) that
+     *          is moved to wherever modifications happen. As edits in a text widget
+     *          mostly occur around the cursor, inserting or removing characters only
+     *          costs a move of the gap when the cursor changes and is constant time
+     *          (amortized) otherwise, no matter the length of the text.
+     *          Read access is provided through `std::string_view` so that rendering
+     *          and measurement do not need to copy the text.
+     */
+    class GapBuffer {
+      public:
+
+        /**
+         * @brief - Creates a new buffer holding the input text.
+         * @param text - the initial content of the buffer.
+         */
+        explicit
+        GapBuffer(std::string_view text = std::string_view());
+
+        ~GapBuffer() = default;
+
+        /**
+         * @brief - Replaces the content of this buffer with the input text.
+         * @param text - the new content of the buffer.
+         * @return - a reference to this buffer.
+         */
+        GapBuffer&
+        operator=(std::string_view text);
+
+        std::size_t
+        size() const noexcept;
+
+        bool
+        empty() const noexcept;
+
+        /**
+         * @brief - Returns the character at index `id`. No bound checks are
+         *          performed.
+         * @param id - the index of the character to retrieve.
+         * @return - the character at the specified index.
+         */
+        char
+        operator[](std::size_t id) const noexcept;
+
+        /**
+         * @brief - Inserts the character `c` at position `pos` in the text. If
+         *          the position is larger than the size of the text the char is
+         *          appended at the end.
+         * @param pos - the index at which the character should be inserted.
+         * @param c - the character to insert.
+         */
+        void
+        insert(std::size_t pos,
+               char c);
+
+        /**
+         * @brief - Removes the characters in the range `[begin; end[` from the
+         *          text. The range is clamped to the size of the text.
+         * @param begin - the index of the first character to remove.
+         * @param end - the index of the first character to keep after the range.
+         */
+        void
+        erase(std::size_t begin,
+              std::size_t end);
+
+        /**
+         * @brief - Returns a view on the range `[pos; pos + count[` of the text.
+         *          The range is clamped to the size of the text. In case the
+         *          range spans the gap, the gap is moved right after it so that
+         *          the characters are contiguous: the returned view is valid as
+         *          long as this buffer is not accessed again.
+         * @param pos - the index of the first character of the view.
+         * @param count - the number of characters of the view.
+         * @return - a view on the requested part of the text.
+         */
+        std::string_view
+        view(std::size_t pos = 0u,
+             std::size_t count = std::string_view::npos) const noexcept;
+
+        /**
+         * @brief - Returns the text as the two parts located on each side of the gap.
+         *          Unlike `view` this never moves the gap: the text is the concatenation
+         *          of both parts.
+         * @return - the parts of the text before and after the gap.
+         */
+        std::pair<std::string_view, std::string_view>
+        segments() const noexcept;
+
+        /**
+         * @brief - Returns a copy of the whole text as a string.
+         * @return - a string with the content of this buffer.
+         */
+        std::string
+        str() const;
+
+      private:
+
+        std::size_t
+        gapSize() const noexcept;
+
+        /**
+         * @brief - Moves the gap so that it starts right at `pos`. The cost of
+         *          this operation is linear in the distance between the current
+         *          position of the gap and `pos`.
+         * @param pos - the new start of the gap.
+         */
+        void
+        moveGap(std::size_t pos) const noexcept;
+
+        /**
+         * @brief - Makes sure that the gap can hold at least `count` characters.
+         *          The buffer grows geometrically so that repeated insertions are
+         *          constant time on average.
+         * @param count - the minimum number of characters the gap should hold.
+         */
+        void
+        reserveGap(std::size_t count);
+
+      private:
+
+        /**
+         * @brief - The minimum size of the gap when the buffer is allocated.
+         */
+        static constexpr std::size_t sk_minGapSize = 16u;
+
+        /**
+         * @brief - The storage for both the text and the gap. The text is made
+         *          of the characters in `[0; m_gapStart[` followed by the ones
+         *          in `[m_gapEnd; m_buffer.size()[`.
+         *          The gap can be moved by read accessors which explains why the
+         *          attributes are mutable.
+         */
+        mutable std::string m_buffer;
+        mutable std::size_t m_gapStart;
+        mutable std::size_t m_gapEnd;
+    };
+
+  }
+}
+
+# include "GapBuffer.hxx"
+
+#endif    /* GAP_BUFFER_HH */
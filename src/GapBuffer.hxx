@@ -0,0 +1,180 @@
+#ifndef    GAP_BUFFER_HXX
+# define   GAP_BUFFER_HXX
+
+# include "GapBuffer.hh"
+
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    GapBuffer::GapBuffer(std::string_view text):
+      m_buffer(),
+      m_gapStart(0u),
+      m_gapEnd(0u)
+    {
+      *this = text;
+    }
+
+    inline
+    GapBuffer&
+    GapBuffer::operator=(std::string_view text) {
+      // Place the gap at the end of the text: this is where most of the
+      // insertions happen when typing.
+      m_buffer.assign(text.size() + sk_minGapSize, '\0');
+      std::copy(text.cbegin(), text.cend(), m_buffer.begin());
+
+      m_gapStart = text.size();
+      m_gapEnd = m_buffer.size();
+
+      return *this;
+    }
+
+    inline
+    std::size_t
+    GapBuffer::size() const noexcept {
+      return m_buffer.size() - gapSize();
+    }
+
+    inline
+    bool
+    GapBuffer::empty() const noexcept {
+      return size() == 0u;
+    }
+
+    inline
+    char
+    GapBuffer::operator[](std::size_t id) const noexcept {
+      return (id < m_gapStart ? m_buffer[id] : m_buffer[id + gapSize()]);
+    }
+
+    inline
+    void
+    GapBuffer::insert(std::size_t pos,
+                      char c)
+    {
+      moveGap(std::min(pos, size()));
+      reserveGap(1u);
+
+      m_buffer[m_gapStart] = c;
+      ++m_gapStart;
+    }
+
+    inline
+    void
+    GapBuffer::erase(std::size_t begin,
+                     std::size_t end)
+    {
+      const std::size_t last = std::min(end, size());
+      if (begin >= last) {
+        return;
+      }
+
+      // Removing characters only means extending the gap over them.
+      moveGap(begin);
+      m_gapEnd += (last - begin);
+    }
+
+    inline
+    std::string_view
+    GapBuffer::view(std::size_t pos,
+                    std::size_t count) const noexcept
+    {
+      const std::size_t first = std::min(pos, size());
+      const std::size_t last = first + std::min(count, size() - first);
+
+      // In case the range spans the gap, move it out of the way. We move it
+      // after the range as measurements usually query increasing prefixes of
+      // the text: this way the following requests are already contiguous.
+      if (first < m_gapStart && last > m_gapStart) {
+        moveGap(last);
+      }
+
+      const std::size_t offset = (first < m_gapStart ? 0u : gapSize());
+
+      return std::string_view(m_buffer.data() + first + offset, last - first);
+    }
+
+    inline
+    std::pair<std::string_view, std::string_view>
+    GapBuffer::segments() const noexcept {
+      return std::make_pair(
+        std::string_view(m_buffer.data(), m_gapStart),
+        std::string_view(m_buffer.data() + m_gapEnd, m_buffer.size() - m_gapEnd)
+      );
+    }
+
+    inline
+    std::string
+    GapBuffer::str() const {
+      std::string out;
+      out.reserve(size());
+
+      out.append(m_buffer, 0u, m_gapStart);
+      out.append(m_buffer, m_gapEnd, std::string::npos);
+
+      return out;
+    }
+
+    inline
+    std::size_t
+    GapBuffer::gapSize() const noexcept {
+      return m_gapEnd - m_gapStart;
+    }
+
+    inline
+    void
+    GapBuffer::moveGap(std::size_t pos) const noexcept {
+      if (pos < m_gapStart) {
+        // Move the characters in `[pos; m_gapStart[` at the end of the gap.
+        const std::size_t count = m_gapStart - pos;
+        std::copy_backward(
+          m_buffer.begin() + pos,
+          m_buffer.begin() + m_gapStart,
+          m_buffer.begin() + m_gapEnd
+        );
+
+        m_gapStart -= count;
+        m_gapEnd -= count;
+      }
+      else if (pos > m_gapStart) {
+        // Move the characters right after the gap at its beginning.
+        const std::size_t count = pos - m_gapStart;
+        std::copy(
+          m_buffer.begin() + m_gapEnd,
+          m_buffer.begin() + m_gapEnd + count,
+          m_buffer.begin() + m_gapStart
+        );
+
+        m_gapStart += count;
+        m_gapEnd += count;
+      }
+    }
+
+    inline
+    void
+    GapBuffer::reserveGap(std::size_t count) {
+      if (gapSize() >= count) {
+        return;
+      }
+
+      // Grow the buffer geometrically and move the content located after the
+      // gap at the end of the new buffer.
+      const std::size_t tail = m_buffer.size() - m_gapEnd;
+      const std::size_t capacity = std::max(2u * m_buffer.size(), size() + count + sk_minGapSize);
+
+      m_buffer.resize(capacity, '\0');
+      std::copy_backward(
+        m_buffer.begin() + m_gapEnd,
+        m_buffer.begin() + m_gapEnd + tail,
+        m_buffer.end()
+      );
+
+      m_gapEnd = capacity - tail;
+    }
+
+  }
+}
+
+#endif    /* GAP_BUFFER_HXX */
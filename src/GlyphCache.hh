@@ -0,0 +1,235 @@
+#ifndef    GLYPH_CACHE_HH
+# define   GLYPH_CACHE_HH
+
+# include <string>
+# include <cstdint>
+# include <functional>
+# include <string_view>
+# include <unordered_map>
+# include <maths_utils/Box.hh>
+# include <maths_utils/Size.hh>
+# include <core_utils/Uuid.hh>
+# include <sdl_engine/Palette.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Cache of rendered glyphs for a single font. Texts are expected to be
+     *          encoded in UTF-8: each code point is rendered from its whole sequence
+     *          of bytes once for each color role into its own texture and its size
+     *          is kept alongside: strings are then drawn as runs of glyphs and measured
+     *          by summing the cached advances. Modifying a text does not require to
+     *          render it again nor to allocate any texture, which is useful for text
+     *          that changes often (such as numeric values).
+     *          The cache does not talk to the engine directly: the widgets using it
+     *          provide a `loader` to create a glyph on a cache miss and a `painter`
+     *          to blit a glyph. This allows to keep the engine calls in the widgets
+     *          where the engine and the font are available.
+     *          The size of the strings measured recently is also kept so that common
+     *          queries (such as the position of the cursor in a text) do not need to
+     *          go through the glyphs.
+     *          Note that kerning is not applied between glyphs.
+     */
+    class GlyphCache {
+      public:
+
+        using Role = core::engine::Palette::ColorRole;
+
+        /**
+         * @brief - Describes a rendered glyph: the texture holding it and its size.
+         *          The width of the glyph is used as its advance.
+         */
+        struct Glyph {
+          utils::Uuid texture;
+          utils::Sizef size;
+        };
+
+        /**
+         * @brief - Statistics about the use of the cache since its creation. The
+         *          `measurements` counts the calls to `measure` and `hits` the ones
+         *          answered from the table of measured strings. The `glyphs` counts
+         *          the glyphs which had to be rendered.
+         */
+        struct Stats {
+          std::size_t measurements;
+          std::size_t hits;
+          std::size_t glyphs;
+
+          /**
+           * @brief - The ratio of measurements answered without going through the
+           *          glyphs. Returns `0` if no measurement was performed.
+           * @return - the hit rate of the measurements in `[0; 1]`.
+           */
+          float
+          hitRate() const noexcept;
+        };
+
+        GlyphCache();
+
+        ~GlyphCache() = default;
+
+        /**
+         * @brief - Used to retrieve the glyph representing the first code point of the
+         *          `character` with the specified role. The glyph is created through the
+         *          `loader` if it is not yet available.
+         * @param character - the UTF-8 sequence of the code point to retrieve. Bytes
+         *                    after the first code point are ignored.
+         * @param role - the color role of the glyph.
+         * @param loader - a callable `Glyph(std::string_view, Role)` creating the glyph
+         *                 from the UTF-8 sequence of a code point.
+         * @return - the glyph for the code point.
+         */
+        template <typename Loader>
+        const Glyph&
+        glyph(std::string_view character,
+              const Role& role,
+              Loader&& loader);
+
+        /**
+         * @brief - Used to create the glyphs of all the code points of the input text
+         *          which are not yet available, without measuring the text.
+         * @param text - the text containing the code points to load.
+         * @param role - the color role of the glyphs.
+         * @param loader - a callable `Glyph(std::string_view, Role)` creating missing
+         *                 glyphs.
+         */
+        template <typename Loader>
+        void
+        preload(std::string_view text,
+                const Role& role,
+                Loader&& loader);
+
+        /**
+         * @brief - Computes the size of the input text when drawn with glyphs of this
+         *          cache. The size of recently measured strings is returned directly
+         *          and missing glyphs are created through the `loader`.
+         * @param text - the text to measure.
+         * @param role - the color role of the glyphs.
+         * @param loader - a callable `Glyph(std::string_view, Role)` creating missing
+         *                 glyphs.
+         * @return - the size of the text.
+         */
+        template <typename Loader>
+        utils::Sizef
+        measure(std::string_view text,
+                const Role& role,
+                Loader&& loader);
+
+        /**
+         * @brief - Lays out the input text in the `dst` area (assumed to be as large as
+         *          returned by `measure`) and calls the `painter` for each glyph along
+         *          with the area it covers. The area is expressed in the same frame
+         *          as `dst`.
+         * @param text - the text to draw.
+         * @param role - the color role of the glyphs.
+         * @param dst - the area covered by the whole text.
+         * @param loader - a callable `Glyph(std::string_view, Role)` creating missing
+         *                 glyphs.
+         * @param painter - a callable `void(const Glyph&, const utils::Boxf&)` which
+         *                  draws a glyph at the specified position.
+         */
+        template <typename Loader, typename Painter>
+        void
+        draw(std::string_view text,
+             const Role& role,
+             const utils::Boxf& dst,
+             Loader&& loader,
+             Painter&& painter);
+
+        /**
+         * @brief - Removes all the glyphs and measurements from the cache. The `releaser`
+         *          is called on each texture so that it can be destroyed. The statistics
+         *          are kept.
+         * @param releaser - a callable `void(const utils::Uuid&)` releasing a texture.
+         */
+        template <typename Releaser>
+        void
+        clear(Releaser&& releaser);
+
+        bool
+        empty() const noexcept;
+
+        const Stats&
+        getStats() const noexcept;
+
+      private:
+
+        /**
+         * @brief - Decodes the first code point of the input UTF-8 text. Bytes which do
+         *          not start a valid sequence are decoded as a code point of their own
+         *          (outside of the range of Unicode) so that they can still be drawn.
+         * @param text - the text to decode, assumed not to be empty.
+         * @param cp - output argument receiving the decoded code point.
+         * @return - the number of bytes of the sequence of the code point.
+         */
+        static
+        std::size_t
+        decode(std::string_view text,
+               char32_t& cp) noexcept;
+
+        /**
+         * @brief - Builds the key of the glyph representing the code point `cp` with the
+         *          specified role in the `m_glyphs` table.
+         * @param cp - the code point.
+         * @param role - the color role of the glyph.
+         * @return - a key uniquely identifying the glyph.
+         */
+        static
+        std::uint64_t
+        key(char32_t cp,
+            const Role& role) noexcept;
+
+      private:
+
+        /**
+         * @brief - Hash allowing to look up measured strings from a view without having
+         *          to build a string.
+         */
+        struct TextHash {
+          using is_transparent = void;
+
+          std::size_t
+          operator()(std::string_view text) const noexcept;
+        };
+
+        using GlyphsMap = std::unordered_map<std::uint64_t, Glyph>;
+        using MeasurementsMap = std::unordered_map<std::string, utils::Sizef, TextHash, std::equal_to<>>;
+        using RoleMeasurementsMap = std::unordered_map<Role, MeasurementsMap>;
+
+        /**
+         * @brief - The first code point used to represent the invalid bytes of a text.
+         */
+        static constexpr char32_t sk_invalidBytes = 0x110000u;
+
+        /**
+         * @brief - The maximum number of strings kept in the `m_measurements` table for
+         *          each role. The table is emptied when it is full: recent strings are
+         *          measured again from the glyphs quickly.
+         */
+        static constexpr std::size_t sk_maxMeasurements = 256u;
+
+        /**
+         * @brief - The glyphs rendered so far indexed by their code point and role.
+         */
+        GlyphsMap m_glyphs;
+
+        /**
+         * @brief - The size of the strings measured recently indexed by the role of their
+         *          glyphs and by their content: glyphs of different roles do not need to
+         *          have the same size.
+         */
+        RoleMeasurementsMap m_measurements;
+
+        /**
+         * @brief - The statistics about the use of the cache.
+         */
+        Stats m_stats;
+    };
+
+  }
+}
+
+# include "GlyphCache.hxx"
+
+#endif    /* GLYPH_CACHE_HH */
@@ -0,0 +1,233 @@
+#ifndef    GLYPH_CACHE_HXX
+# define   GLYPH_CACHE_HXX
+
+# include "GlyphCache.hh"
+
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    float
+    GlyphCache::Stats::hitRate() const noexcept {
+      if (measurements == 0u) {
+        return 0.0f;
+      }
+
+      return 1.0f * hits / measurements;
+    }
+
+    inline
+    GlyphCache::GlyphCache():
+      m_glyphs(),
+      m_measurements(),
+      m_stats(Stats{0u, 0u, 0u})
+    {
+      // Nothing to do.
+    }
+
+    template <typename Loader>
+    inline
+    const GlyphCache::Glyph&
+    GlyphCache::glyph(std::string_view character,
+                      const Role& role,
+                      Loader&& loader)
+    {
+      char32_t cp = 0u;
+      const std::size_t length = decode(character, cp);
+
+      const std::uint64_t k = key(cp, role);
+
+      GlyphsMap::const_iterator it = m_glyphs.find(k);
+      if (it == m_glyphs.cend()) {
+        it = m_glyphs.emplace(k, loader(character.substr(0u, length), role)).first;
+        ++m_stats.glyphs;
+      }
+
+      return it->second;
+    }
+
+    template <typename Loader>
+    inline
+    void
+    GlyphCache::preload(std::string_view text,
+                        const Role& role,
+                        Loader&& loader)
+    {
+      char32_t cp = 0u;
+
+      while (!text.empty()) {
+        glyph(text, role, loader);
+        text.remove_prefix(decode(text, cp));
+      }
+    }
+
+    template <typename Loader>
+    inline
+    utils::Sizef
+    GlyphCache::measure(std::string_view text,
+                        const Role& role,
+                        Loader&& loader)
+    {
+      ++m_stats.measurements;
+
+      MeasurementsMap& measured = m_measurements[role];
+
+      MeasurementsMap::const_iterator it = measured.find(text);
+      if (it != measured.cend()) {
+        ++m_stats.hits;
+        return it->second;
+      }
+
+      float w = 0.0f;
+      float h = 0.0f;
+
+      char32_t cp = 0u;
+      std::string_view remaining = text;
+
+      while (!remaining.empty()) {
+        const Glyph& g = glyph(remaining, role, loader);
+
+        w += g.size.w();
+        h = std::max(h, g.size.h());
+
+        remaining.remove_prefix(decode(remaining, cp));
+      }
+
+      if (measured.size() >= sk_maxMeasurements) {
+        measured.clear();
+      }
+
+      const utils::Sizef size(w, h);
+      measured.emplace(std::string(text), size);
+
+      return size;
+    }
+
+    template <typename Loader, typename Painter>
+    inline
+    void
+    GlyphCache::draw(std::string_view text,
+                     const Role& role,
+                     const utils::Boxf& dst,
+                     Loader&& loader,
+                     Painter&& painter)
+    {
+      // Glyphs are laid out from the left of the area and vertically centered.
+      float x = dst.getLeftBound();
+
+      char32_t cp = 0u;
+
+      while (!text.empty()) {
+        const Glyph& g = glyph(text, role, loader);
+
+        if (g.texture.valid()) {
+          painter(g, utils::Boxf(x + g.size.w() / 2.0f, dst.y(), g.size));
+        }
+
+        x += g.size.w();
+
+        text.remove_prefix(decode(text, cp));
+      }
+    }
+
+    template <typename Releaser>
+    inline
+    void
+    GlyphCache::clear(Releaser&& releaser) {
+      for (GlyphsMap::const_iterator it = m_glyphs.cbegin() ; it != m_glyphs.cend() ; ++it) {
+        if (it->second.texture.valid()) {
+          releaser(it->second.texture);
+        }
+      }
+
+      m_glyphs.clear();
+      m_measurements.clear();
+    }
+
+    inline
+    bool
+    GlyphCache::empty() const noexcept {
+      return m_glyphs.empty();
+    }
+
+    inline
+    const GlyphCache::Stats&
+    GlyphCache::getStats() const noexcept {
+      return m_stats;
+    }
+
+    inline
+    std::size_t
+    GlyphCache::decode(std::string_view text,
+                       char32_t& cp) noexcept
+    {
+      const unsigned char lead = static_cast<unsigned char>(text[0]);
+
+      if (lead < 0x80u) {
+        cp = lead;
+        return 1u;
+      }
+
+      // Determine the length of the sequence from its first byte.
+      std::size_t length = 0u;
+      char32_t value = 0u;
+      char32_t min = 0u;
+
+      if ((lead & 0xE0u) == 0xC0u) {
+        length = 2u;
+        value = lead & 0x1Fu;
+        min = 0x80u;
+      }
+      else if ((lead & 0xF0u) == 0xE0u) {
+        length = 3u;
+        value = lead & 0x0Fu;
+        min = 0x800u;
+      }
+      else if ((lead & 0xF8u) == 0xF0u) {
+        length = 4u;
+        value = lead & 0x07u;
+        min = 0x10000u;
+      }
+
+      bool valid = (length > 0u && text.size() >= length);
+
+      for (std::size_t id = 1u ; valid && id < length ; ++id) {
+        const unsigned char byte = static_cast<unsigned char>(text[id]);
+
+        valid = ((byte & 0xC0u) == 0x80u);
+        value = (value << 6u) | (byte & 0x3Fu);
+      }
+
+      // Overlong sequences, surrogates and values out of the range of Unicode
+      // are not valid either.
+      valid = valid && value >= min && value <= 0x10FFFFu && (value < 0xD800u || value > 0xDFFFu);
+
+      if (!valid) {
+        cp = sk_invalidBytes + lead;
+        return 1u;
+      }
+
+      cp = value;
+      return length;
+    }
+
+    inline
+    std::uint64_t
+    GlyphCache::key(char32_t cp,
+                    const Role& role) noexcept
+    {
+      return (static_cast<std::uint64_t>(role) << 32u) | cp;
+    }
+
+    inline
+    std::size_t
+    GlyphCache::TextHash::operator()(std::string_view text) const noexcept {
+      return std::hash<std::string_view>()(text);
+    }
+
+  }
+}
+
+#endif    /* GLYPH_CACHE_HXX */
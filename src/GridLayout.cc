@@ -8,6 +8,8 @@
 namespace sdl {
   namespace graphic {
 
+    const unsigned GridLayout::sk_maxSpanIterations = 8u;
+
     GridLayout::GridLayout(const std::string& name,
                            core::SdlWidget* widget,
                            unsigned columns,
@@ -20,6 +22,9 @@ namespace sdl {
       m_columnsInfo(),
       m_rowsInfo(),
 
+      m_uniformColumns(false),
+      m_uniformRows(false),
+
       m_locations()
     {
       // Build default information for columns/rows.
@@ -40,6 +45,8 @@ namespace sdl {
       // the final dimensions do correspond to the criteria applied to all
       // the items registered for a single column/row.
 
+      LAYOUT_STATS(m_stats.start());
+
       // First, we need to compute the available size for this layout. We need
       // to take into account margins.
       const utils::Sizef internalSize = computeAvailableSize(window);
@@ -51,6 +58,8 @@ namespace sdl {
       // requesting constantly information or setting information multiple times.
       std::vector<WidgetInfo> itemsInfo = computeItemsInfo();
 
+      LAYOUT_STATS(m_stats.phase(layout::Phase::ItemsInfo));
+
       // Once this is done, we can start applying specific behavior to this layout.
       // The first thing we want to do is handling the minimum column width and
       // minimum row height attributes. These are specified on a per column/row
@@ -111,6 +120,8 @@ namespace sdl {
       // will directly impact it.
       adjustItemToConstraints(internalSize, itemsInfo);
 
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Constraints));
+
       notice("Available size: " + std::to_string(window.w()) + "x" + std::to_string(window.h()));
       notice("Internal size: " + std::to_string(internalSize.w()) + "x" + std::to_string(internalSize.h()));
 
@@ -133,26 +144,68 @@ namespace sdl {
       // Once all single-cell items have been laid out, we can try to further adjust
       // the resulting distribution to multi-cell items. At this point, the best case
       // scenario is that the items will take advantage of the computed repartition
-      // and that no other adjustment will occur. This is rarely the case though and
-      // we might have to redo an adjustment for single-cell items afterwards.
+      // and that no other adjustment will occur. This is rarely the case though: the
+      // multi-cell solver thus enlarges the lines which cannot hold their spanning
+      // items and readjusts the single-cell items of these lines afterwards.
+
+      // Before running the optimization process we check whether the columns or
+      // the rows are uniform: in this case all the lines behave the same way and
+      // there's no space which could be redistributed from one line to another.
+      // The dimensions can thus be computed in closed form which is much cheaper
+      // than the iterative process for large tables.
 
       // Proceed to adjust the columns' width.
-      notice("Adjusting columns width");
-      std::vector<float> columnsDims = adjustColumnsWidth(internalSize, itemsInfo, cells);
+      std::vector<float> columnsDims;
+      if (hasUniformColumns(itemsInfo)) {
+        notice("Computing uniform columns width");
+        columnsDims = computeUniformColumnsWidth(internalSize, itemsInfo, cells);
+      }
+      else {
+        notice("Adjusting columns width");
+        columnsDims = adjustColumnsWidth(internalSize, itemsInfo, cells);
+      }
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Columns));
 
       // Adjust rows' height.
-      notice("Adjusting rows height");
-      std::vector<float> rowsDims = adjustRowHeight(internalSize, itemsInfo, cells);
+      std::vector<float> rowsDims;
+      if (hasUniformRows(itemsInfo)) {
+        notice("Computing uniform rows height");
+        rowsDims = computeUniformRowsHeight(internalSize, itemsInfo, cells);
+      }
+      else {
+        notice("Adjusting rows height");
+        rowsDims = adjustRowHeight(internalSize, itemsInfo, cells);
+      }
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Rows));
 
       // Adjust multi-cell item to make them span the columns/rows they are spanning.
       // When shrinking the item we might indeed shrink too much some items which
       // creates some weird distribution where a multi-cell is smaller than a single cell
       // just because it was able to get one more shrinking iteration.
+      // Spanning items are processed in increasing span order and may enlarge the
+      // lines they span if they cannot fit in them: the number of passes is bounded
+      // so that the relayout time stays predictable.
       notice("Adjusting multi-cell width");
-      adjustMultiCellWidth(columnsDims, itemsInfo, cells);
+      const SpanReport widthReport = adjustMultiCellWidth(columnsDims, itemsInfo, cells);
 
       notice("Adjusting multi-cell height");
-      adjustMultiCellHeight(rowsDims, itemsInfo, cells);
+      const SpanReport heightReport = adjustMultiCellHeight(rowsDims, itemsInfo, cells);
+
+      if (!widthReport.converged || !heightReport.converged) {
+        warn(
+          std::string("Multi-cell solver did not converge (width: ") + std::to_string(widthReport.iterations) +
+          " pass(es), height: " + std::to_string(heightReport.iterations) + " pass(es))"
+        );
+      }
+
+      notice(
+        std::string("Solved ") + std::to_string(widthReport.spans) + " multi-cell item(s), overflow is " +
+        std::to_string(widthReport.overflow) + "x" + std::to_string(heightReport.overflow)
+      );
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::MultiCell));
 
       // All items have suited dimensions, we can now handle the position of each
       // item. We basically just move each item based on the dimensions of the
@@ -221,10 +274,14 @@ namespace sdl {
           xItem, yItem,
           cells[index].box.w(), cells[index].box.h()
         );
+
+        LAYOUT_STATS(m_stats.clamp(cells[index].box.toSize(), itemsInfo[index].min, itemsInfo[index].max));
       }
 
       // Assign the rendering area to items.
       assignRenderingAreas(outputBoxes, window);
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Positioning));
     }
 
     bool
@@ -674,6 +731,7 @@ namespace sdl {
       // checking whether a column is available for adjustment: we only avoid another
       // indirection to fetch the item when performing the adjustments.
       while (!itemsToAdjust.empty() && !allSpaceUsed) {
+        LAYOUT_STATS(m_stats.iteration());
 
         // Compute the amount of space we will try to allocate to each column still
         // available for adjustment.
@@ -1077,6 +1135,7 @@ namespace sdl {
       // checking whether a row is available for adjustment: we only avoid another
       // indirection to fetch the item when performing the adjustments.
       while (!itemsToAdjust.empty() && !allSpaceUsed) {
+        LAYOUT_STATS(m_stats.iteration());
 
         // Compute the amount of space we will try to allocate to each row still
         // available for adjustment.
@@ -1323,8 +1382,269 @@ namespace sdl {
       return rows;
     }
 
-    void
-    GridLayout::adjustMultiCellWidth(const std::vector<float>& columns,
+    bool
+    GridLayout::hasUniformColumns(const std::vector<WidgetInfo>& items) const noexcept {
+      // The user might have declared the columns as uniform.
+      if (m_uniformColumns) {
+        return true;
+      }
+
+      // All the columns should share the same information.
+      for (unsigned column = 1u ; column < m_columns ; ++column) {
+        if (m_columnsInfo[column].stretch != m_columnsInfo[0u].stretch ||
+            m_columnsInfo[column].min != m_columnsInfo[0u].min)
+        {
+          return false;
+        }
+      }
+
+      // Traverse the items and compare their horizontal constraints with the
+      // ones of the first visible item. We also keep track of the columns which
+      // contain at least one item: empty columns are assigned their minimum
+      // width by the optimization process which breaks the uniformity.
+      std::vector<bool> populated(m_columns, false);
+      int reference = -1;
+
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (!items[item->first].visible) {
+          continue;
+        }
+
+        // Multi-cell items are handled by the iterative process.
+        if (item->second.w > 1) {
+          return false;
+        }
+
+        populated[item->second.x] = true;
+
+        if (reference < 0) {
+          reference = item->first;
+          continue;
+        }
+
+        const WidgetInfo& ref = items[reference];
+        const WidgetInfo& cur = items[item->first];
+
+        if (ref.min.isValid() != cur.min.isValid() || (cur.min.isValid() && ref.min.w() != cur.min.w()) ||
+            ref.hint.isValid() != cur.hint.isValid() || (cur.hint.isValid() && ref.hint.w() != cur.hint.w()) ||
+            ref.max.isValid() != cur.max.isValid() || (cur.max.isValid() && ref.max.w() != cur.max.w()) ||
+            ref.policy.canExtendHorizontally() != cur.policy.canExtendHorizontally() ||
+            ref.policy.canShrinkHorizontally() != cur.policy.canShrinkHorizontally() ||
+            ref.policy.canExpandHorizontally() != cur.policy.canExpandHorizontally())
+        {
+          return false;
+        }
+      }
+
+      return reference >= 0 && std::find(populated.cbegin(), populated.cend(), false) == populated.cend();
+    }
+
+    bool
+    GridLayout::hasUniformRows(const std::vector<WidgetInfo>& items) const noexcept {
+      // The user might have declared the rows as uniform.
+      if (m_uniformRows) {
+        return true;
+      }
+
+      // All the rows should share the same information.
+      for (unsigned row = 1u ; row < m_rows ; ++row) {
+        if (m_rowsInfo[row].stretch != m_rowsInfo[0u].stretch ||
+            m_rowsInfo[row].min != m_rowsInfo[0u].min)
+        {
+          return false;
+        }
+      }
+
+      // Similar to the columns case: compare the vertical constraints of all the
+      // visible items and check that no row is empty.
+      std::vector<bool> populated(m_rows, false);
+      int reference = -1;
+
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (!items[item->first].visible) {
+          continue;
+        }
+
+        if (item->second.h > 1) {
+          return false;
+        }
+
+        populated[item->second.y] = true;
+
+        if (reference < 0) {
+          reference = item->first;
+          continue;
+        }
+
+        const WidgetInfo& ref = items[reference];
+        const WidgetInfo& cur = items[item->first];
+
+        if (ref.min.isValid() != cur.min.isValid() || (cur.min.isValid() && ref.min.h() != cur.min.h()) ||
+            ref.hint.isValid() != cur.hint.isValid() || (cur.hint.isValid() && ref.hint.h() != cur.hint.h()) ||
+            ref.max.isValid() != cur.max.isValid() || (cur.max.isValid() && ref.max.h() != cur.max.h()) ||
+            ref.policy.canExtendVertically() != cur.policy.canExtendVertically() ||
+            ref.policy.canShrinkVertically() != cur.policy.canShrinkVertically() ||
+            ref.policy.canExpandVertically() != cur.policy.canExpandVertically())
+        {
+          return false;
+        }
+      }
+
+      return reference >= 0 && std::find(populated.cbegin(), populated.cend(), false) == populated.cend();
+    }
+
+    std::vector<float>
+    GridLayout::computeUniformColumnsWidth(const utils::Sizef& window,
+                                           const std::vector<WidgetInfo>& items,
+                                           std::vector<CellInfo>& cells) const
+    {
+      // Empty columns are assigned their minimum width: this can only happen
+      // when the user declared the columns as uniform. The rest of the space
+      // is shared equally among the other columns.
+      std::vector<float> columns(m_columns, 0.0f);
+      std::vector<bool> populated(m_columns, false);
+
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (items[item->first].visible) {
+          for (unsigned column = 0u ; column < item->second.w ; ++column) {
+            populated[item->second.x + column] = true;
+          }
+        }
+      }
+
+      float spaceToUse = window.w();
+      unsigned columnsRemaining = 0u;
+
+      for (unsigned column = 0u ; column < m_columns ; ++column) {
+        if (!populated[column]) {
+          columns[column] = m_columnsInfo[column].min;
+          spaceToUse -= columns[column];
+        }
+        else {
+          ++columnsRemaining;
+        }
+      }
+
+      const float defaultWidth = allocateFairly(spaceToUse, columnsRemaining);
+
+      // Apply the fair share to each item in a single pass: as all the columns
+      // share the same constraints, the policy yields the same answer for each
+      // of them and no redistribution can happen.
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (!items[item->first].visible) {
+          continue;
+        }
+
+        const ItemInfo& info = item->second;
+
+        const float width = computeWidthFromPolicy(cells[item->first].box, defaultWidth * info.w, items[item->first]);
+        cells[item->first].box.w() = width;
+
+        for (unsigned column = 0u ; column < info.w ; ++column) {
+          columns[info.x + column] = std::max(columns[info.x + column], width / info.w);
+        }
+      }
+
+      // Warn the user in case we could not use all the space.
+      float achievedWidth = 0.0f;
+      for (unsigned column = 0u ; column < m_columns ; ++column) {
+        achievedWidth += columns[column];
+      }
+
+      const utils::Sizef achievedSize(achievedWidth, window.h());
+      if (!achievedSize.compareWithTolerance(window, 1.0f)) {
+        warn(
+          std::string("Could only achieve width of ") + std::to_string(achievedWidth) +
+          " but available space is " + std::to_string(window.w())
+        );
+      }
+
+      return columns;
+    }
+
+    std::vector<float>
+    GridLayout::computeUniformRowsHeight(const utils::Sizef& window,
+                                         const std::vector<WidgetInfo>& items,
+                                         std::vector<CellInfo>& cells) const
+    {
+      // Similar to the columns case.
+      std::vector<float> rows(m_rows, 0.0f);
+      std::vector<bool> populated(m_rows, false);
+
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (items[item->first].visible) {
+          for (unsigned row = 0u ; row < item->second.h ; ++row) {
+            populated[item->second.y + row] = true;
+          }
+        }
+      }
+
+      float spaceToUse = window.h();
+      unsigned rowsRemaining = 0u;
+
+      for (unsigned row = 0u ; row < m_rows ; ++row) {
+        if (!populated[row]) {
+          rows[row] = m_rowsInfo[row].min;
+          spaceToUse -= rows[row];
+        }
+        else {
+          ++rowsRemaining;
+        }
+      }
+
+      const float defaultHeight = allocateFairly(spaceToUse, rowsRemaining);
+
+      for (LocationsMap::const_iterator item = m_locations.cbegin() ;
+           item != m_locations.cend() ;
+           ++item)
+      {
+        if (!items[item->first].visible) {
+          continue;
+        }
+
+        const ItemInfo& info = item->second;
+
+        const float height = computeHeightFromPolicy(cells[item->first].box, defaultHeight * info.h, items[item->first]);
+        cells[item->first].box.h() = height;
+
+        for (unsigned row = 0u ; row < info.h ; ++row) {
+          rows[info.y + row] = std::max(rows[info.y + row], height / info.h);
+        }
+      }
+
+      float achievedHeight = 0.0f;
+      for (unsigned row = 0u ; row < m_rows ; ++row) {
+        achievedHeight += rows[row];
+      }
+
+      const utils::Sizef achievedSize(window.w(), achievedHeight);
+      if (!achievedSize.compareWithTolerance(window, 1.0f)) {
+        warn(
+          std::string("Could only achieve height of ") + std::to_string(achievedHeight) +
+          " but available space is " + std::to_string(window.h())
+        );
+      }
+
+      return rows;
+    }
+
+    GridLayout::SpanReport
+    GridLayout::adjustMultiCellWidth(std::vector<float>& columns,
                                      const std::vector<WidgetInfo>& items,
                                      std::vector<CellInfo>& cells)
     {
@@ -1332,15 +1652,24 @@ namespace sdl {
       // registered in the input `cells` vector.
       // Due to the mechanism in place to determine the optimal repartition of
       // items, we might end up during shrinking phases with multi-cell items
-      // taking less space than actually available.
-      // In order to fix that, we chose to add an additional phase to account for
-      // an adjustment of the multi-cell items so that they take up all the
-      // available space.
+      // taking less space than actually available or on the contrary with
+      // items which cannot fit in the columns they span.
+      // In order to fix that, we process spanning items in increasing span
+      // order: the narrowest items are the ones constraining the most the
+      // columns so they are handled first. Whenever an item requires more
+      // space than what is provided by its columns the missing width is taken
+      // from the other columns (as long as they stay above their minimum) and
+      // split evenly among the spanned ones. Another pass is then performed
+      // so that items sharing these columns can take advantage of the new
+      // width. The grid thus never grows larger than the available space.
+      // The number of passes is bounded to keep the process predictable.
+
+      // Gather the multi-cell items along with their span.
+      std::vector<std::pair<unsigned, unsigned>> spans;
 
-      // Traverse the list of item and process each multi-cell one.
       for (unsigned item = 0u ; item < cells.size() ; ++item) {
         // Check whether the item is a multi-cell item.
-        if (!cells[item].multiCell) {
+        if (!cells[item].multiCell || !items[cells[item].item].visible) {
           // Move on to the next item.
           continue;
         }
@@ -1355,48 +1684,127 @@ namespace sdl {
             getItemAt(itemID)->getName() + "\" while updating grid layout"
           );
         }
-        const ItemInfo& loc = locIt->second;
 
-        // Determine the total width of the columns spanned by this item.
-        float totalWidth = 0.0f;
-        for (unsigned column = 0u ; column < loc.w ; ++column) {
-          totalWidth += columns[loc.x + column];
+        spans.push_back(std::make_pair(locIt->second.w, item));
+      }
+
+      std::sort(spans.begin(), spans.end());
+
+      SpanReport report{static_cast<unsigned>(spans.size()), 0u, true, 0.0f};
+      std::vector<bool> resized(m_columns, false);
+      bool stable = spans.empty();
+
+      // Compute the width below which each column cannot shrink: this is the
+      // largest of its own minimum and of the minimum of the single-cell
+      // items it contains. Space can only be taken from other columns up to
+      // this limit when a spanning item does not fit.
+      std::vector<float> floors(m_columns, 0.0f);
+      if (!stable) {
+        for (unsigned column = 0u ; column < m_columns ; ++column) {
+          floors[column] = m_columnsInfo[column].min;
+        }
+
+        for (unsigned item = 0u ; item < cells.size() ; ++item) {
+          if (cells[item].multiCell || cells[item].item < 0 || !items[cells[item].item].visible) {
+            continue;
+          }
+
+          const WidgetInfo& info = items[cells[item].item];
+          const LocationsMap::const_iterator locIt = m_locations.find(cells[item].item);
+          if (locIt == m_locations.cend() || !info.min.isValid()) {
+            continue;
+          }
+
+          floors[locIt->second.x] = std::max(floors[locIt->second.x], info.min.w());
+        }
+      }
+
+      while (!stable && report.iterations < sk_maxSpanIterations) {
+        stable = true;
+        ++report.iterations;
+
+        // Only the size still missing after the last pass is reported.
+        report.overflow = 0.0f;
+
+        for (unsigned id = 0u ; id < spans.size() ; ++id) {
+          const unsigned item = spans[id].second;
+          const unsigned itemID = cells[item].item;
+          const ItemInfo& loc = m_locations.find(itemID)->second;
+
+          // Determine the total width of the columns spanned by this item.
+          float totalWidth = 0.0f;
+          for (unsigned column = 0u ; column < loc.w ; ++column) {
+            totalWidth += columns[loc.x + column];
+          }
+
+          // Now try to assign this width to the item: as the `computeWidthFromPolicy`
+          // method tries to *add* the provided width to the existing size of the item
+          // we need to account only for the width difference and not the total width.
+          const float widthIncrement = totalWidth - cells[item].box.w();
+          float width = computeWidthFromPolicy(cells[item].box, widthIncrement, items[itemID]);
+          cells[item].box.w() = width;
+
+          // In case the item does not fit, enlarge the spanned columns with
+          // space taken from the other columns: the total width of the grid
+          // does not change. If not enough space can be found the item is
+          // clamped to the width it could obtain.
+          if (width > totalWidth + 0.5f) {
+            const float granted = redistributeSpanExcess(columns, floors, loc.x, loc.w, width - totalWidth, resized);
+
+            if (width > totalWidth + granted + 0.5f) {
+              report.overflow += (width - totalWidth - granted);
+              cells[item].box.w() = totalWidth + granted;
+            }
+
+            if (granted > 0.5f) {
+              stable = false;
+            }
+          }
+        }
+      }
+
+      report.converged = stable;
+
+      // Single-cell items located in resized columns can now take advantage of
+      // the additional space or shrink to fit their column if their policy
+      // allows it.
+      for (unsigned item = 0u ; item < cells.size() ; ++item) {
+        if (cells[item].multiCell || cells[item].item < 0 || !items[cells[item].item].visible) {
+          continue;
+        }
+
+        const LocationsMap::const_iterator locIt = m_locations.find(cells[item].item);
+        if (locIt == m_locations.cend() || !resized[locIt->second.x]) {
+          continue;
         }
 
-        // Now try to assign this width to the item: as the `computeWidthFromPolicy`
-        // method tries to *add* the provided width to the existing size of the item
-        // we need to account only for the width difference and not the total width.
-        const float widthIncrement = totalWidth - cells[item].box.w();
-        float width = computeWidthFromPolicy(cells[item].box, widthIncrement, items[itemID]);
-        cells[item].box.w() = width;
+        const float widthIncrement = columns[locIt->second.x] - cells[item].box.w();
+        cells[item].box.w() = computeWidthFromPolicy(cells[item].box, widthIncrement, items[cells[item].item]);
       }
+
+      return report;
     }
 
-    void
-    GridLayout::adjustMultiCellHeight(const std::vector<float>& rows,
+    GridLayout::SpanReport
+    GridLayout::adjustMultiCellHeight(std::vector<float>& rows,
                                       const std::vector<WidgetInfo>& items,
                                       std::vector<CellInfo>& cells)
     {
-      // Here we want to perform the last adjustments to the multi-cell items
-      // registered in the input `cells` vector.
-      // Due to the mechanism in place to determine the optimal repartition of
-      // items, we might end up during shrinking phases with multi-cell items
-      // taking less space than actually available.
-      // In order to fix that, we chose to add an additional phase to account for
-      // an adjustment of the multi-cell items so that they take up all the
-      // available space.
+      // Similar to the `adjustMultiCellWidth` method but for rows: spanning
+      // items are processed in increasing span order and may enlarge the rows
+      // they span at the expense of the other rows in a bounded number of
+      // passes.
+
+      // Gather the multi-cell items along with their span.
+      std::vector<std::pair<unsigned, unsigned>> spans;
 
-      // Traverse the list of item and process each multi-cell one.
       for (unsigned item = 0u ; item < cells.size() ; ++item) {
-        // Check whether the item is a multi-cell item.
-        if (!cells[item].multiCell) {
-          // Move on to the next item.
+        if (!cells[item].multiCell || !items[cells[item].item].visible) {
           continue;
         }
 
         const unsigned itemID = cells[item].item;
 
-        // Retrieve the area spanned by this item.
         LocationsMap::const_iterator locIt = m_locations.find(itemID);
         if (locIt == m_locations.cend()) {
           error(
@@ -1404,21 +1812,150 @@ namespace sdl {
             getItemAt(itemID)->getName() + "\" while updating grid layout"
           );
         }
-        const ItemInfo& loc = locIt->second;
 
-        // Determine the total width of the columns spanned by this item.
-        float totalHeight = 0.0f;
-        for (unsigned row = 0u ; row < loc.h ; ++row) {
-          totalHeight += rows[loc.y + row];
+        spans.push_back(std::make_pair(locIt->second.h, item));
+      }
+
+      std::sort(spans.begin(), spans.end());
+
+      SpanReport report{static_cast<unsigned>(spans.size()), 0u, true, 0.0f};
+      std::vector<bool> resized(m_rows, false);
+      bool stable = spans.empty();
+
+      // Compute the height below which each row cannot shrink: this is the
+      // largest of its own minimum and of the minimum of the single-cell
+      // items it contains. Space can only be taken from other rows up to
+      // this limit when a spanning item does not fit.
+      std::vector<float> floors(m_rows, 0.0f);
+      if (!stable) {
+        for (unsigned row = 0u ; row < m_rows ; ++row) {
+          floors[row] = m_rowsInfo[row].min;
+        }
+
+        for (unsigned item = 0u ; item < cells.size() ; ++item) {
+          if (cells[item].multiCell || cells[item].item < 0 || !items[cells[item].item].visible) {
+            continue;
+          }
+
+          const WidgetInfo& info = items[cells[item].item];
+          const LocationsMap::const_iterator locIt = m_locations.find(cells[item].item);
+          if (locIt == m_locations.cend() || !info.min.isValid()) {
+            continue;
+          }
+
+          floors[locIt->second.y] = std::max(floors[locIt->second.y], info.min.h());
+        }
+      }
+
+      while (!stable && report.iterations < sk_maxSpanIterations) {
+        stable = true;
+        ++report.iterations;
+
+        // Only the size still missing after the last pass is reported.
+        report.overflow = 0.0f;
+
+        for (unsigned id = 0u ; id < spans.size() ; ++id) {
+          const unsigned item = spans[id].second;
+          const unsigned itemID = cells[item].item;
+          const ItemInfo& loc = m_locations.find(itemID)->second;
+
+          // Determine the total height of the rows spanned by this item.
+          float totalHeight = 0.0f;
+          for (unsigned row = 0u ; row < loc.h ; ++row) {
+            totalHeight += rows[loc.y + row];
+          }
+
+          // Now try to assign this height to the item: as the `computeHeightFromPolicy`
+          // method tries to *add* the provided height to the existing size of the item
+          // we need to account only for the height difference and not the total height.
+          const float heightIncrement = totalHeight - cells[item].box.h();
+          float height = computeHeightFromPolicy(cells[item].box, heightIncrement, items[itemID]);
+          cells[item].box.h() = height;
+
+          // In case the item does not fit, enlarge the spanned rows with
+          // space taken from the other rows: the total height of the grid
+          // does not change. If not enough space can be found the item is
+          // clamped to the height it could obtain.
+          if (height > totalHeight + 0.5f) {
+            const float granted = redistributeSpanExcess(rows, floors, loc.y, loc.h, height - totalHeight, resized);
+
+            if (height > totalHeight + granted + 0.5f) {
+              report.overflow += (height - totalHeight - granted);
+              cells[item].box.h() = totalHeight + granted;
+            }
+
+            if (granted > 0.5f) {
+              stable = false;
+            }
+          }
+        }
+      }
+
+      report.converged = stable;
+
+      // Single-cell items located in resized rows can now take advantage of
+      // the additional space or shrink to fit their row if their policy
+      // allows it.
+      for (unsigned item = 0u ; item < cells.size() ; ++item) {
+        if (cells[item].multiCell || cells[item].item < 0 || !items[cells[item].item].visible) {
+          continue;
+        }
+
+        const LocationsMap::const_iterator locIt = m_locations.find(cells[item].item);
+        if (locIt == m_locations.cend() || !resized[locIt->second.y]) {
+          continue;
+        }
+
+        const float heightIncrement = rows[locIt->second.y] - cells[item].box.h();
+        cells[item].box.h() = computeHeightFromPolicy(cells[item].box, heightIncrement, items[cells[item].item]);
+      }
+
+      return report;
+    }
+
+    float
+    GridLayout::redistributeSpanExcess(std::vector<float>& lines,
+                                       const std::vector<float>& floors,
+                                       unsigned first,
+                                       unsigned span,
+                                       float excess,
+                                       std::vector<bool>& resized) const noexcept
+    {
+      // Gather the space which can be taken from the lines outside of the
+      // span without making them smaller than their floor.
+      float slack = 0.0f;
+      for (unsigned line = 0u ; line < lines.size() ; ++line) {
+        if (line >= first && line < first + span) {
+          continue;
         }
 
-        // Now try to assign this height to the item: as the `computeHeightFromPolicy`
-        // method tries to *add* the provided height to the existing size of the item
-        // we need to account only for the height difference and not the total height.
-        const float heightIncrement = totalHeight - cells[item].box.h();
-        float height = computeHeightFromPolicy(cells[item].box, heightIncrement, items[itemID]);
-        cells[item].box.h() = height;
+        slack += std::max(0.0f, lines[line] - floors[line]);
+      }
+
+      const float granted = std::min(excess, slack);
+      if (granted <= 0.0f) {
+        return 0.0f;
       }
+
+      // Each line gives away a share of its slack proportional to the
+      // total space needed.
+      const float ratio = granted / slack;
+
+      for (unsigned line = 0u ; line < lines.size() ; ++line) {
+        if (line >= first && line < first + span) {
+          lines[line] += granted / span;
+          resized[line] = true;
+          continue;
+        }
+
+        const float delta = std::max(0.0f, lines[line] - floors[line]) * ratio;
+        if (delta > 0.0f) {
+          lines[line] -= delta;
+          resized[line] = true;
+        }
+      }
+
+      return granted;
     }
 
   }
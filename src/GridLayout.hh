@@ -4,6 +4,7 @@
 # include <memory>
 # include <unordered_map>
 # include <sdl_core/Layout.hh>
+# include "LayoutStats.hh"
 
 namespace sdl {
   namespace graphic {
@@ -43,6 +44,26 @@ namespace sdl {
         void
         setRowsMinimumHeight(float height);
 
+        /**
+         * @brief - Used to declare that all the columns of this layout share the same
+         *          constraints (stretch, minimum width and items' policies). This allows
+         *          the layout to compute the columns' width in closed form rather than
+         *          running the iterative optimization process.
+         *          Note that the layout is able to detect such a configuration on its own
+         *          for single-cell items: this method is meant for callers which know in
+         *          advance that the grid is a table and want to skip the detection.
+         * @param uniform - `true` if the columns should be considered uniform.
+         */
+        void
+        setUniformColumns(bool uniform);
+
+        /**
+         * @brief - Similar to `setUniformColumns` but for rows.
+         * @param uniform - `true` if the rows should be considered uniform.
+         */
+        void
+        setUniformRows(bool uniform);
+
         void
         addItem(core::LayoutItem* container,
                 unsigned x,
@@ -54,6 +75,24 @@ namespace sdl {
         setGrid(unsigned columns,
                 unsigned rows);
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Retrieves the statistics recorded during the last geometry
+         *          computation of this layout.
+         * @return - the statistics of this layout.
+         */
+        const layout::Stats&
+        getStats() const noexcept;
+
+        /**
+         * @brief - Dumps the phases recorded since the last dump in the Chrome trace
+         *          event format. Raises an error if the file cannot be written.
+         * @param file - the path to the output file.
+         */
+        void
+        dumpStatsTrace(const std::string& file);
+# endif
+
       protected:
 
         void
@@ -172,16 +211,130 @@ namespace sdl {
                         const std::vector<WidgetInfo>& items,
                         std::vector<CellInfo>& cells) const;
 
-        void
-        adjustMultiCellWidth(const std::vector<float>& columns,
+        /**
+         * @brief - Used to determine whether the columns of this layout are homogeneous,
+         *          in which case the `computeUniformColumnsWidth` method can be used in
+         *          place of the iterative `adjustColumnsWidth` one.
+         *          Columns are homogeneous if they all share the same information, if
+         *          each of them contains at least one visible item, if no visible item
+         *          spans several columns and if all visible items share the same
+         *          horizontal constraints.
+         *          Note that if the user declared the columns as uniform this method
+         *          returns `true` without any check.
+         * @param items - the information about the items of the layout.
+         * @return - `true` if the columns can be computed in closed form.
+         */
+        bool
+        hasUniformColumns(const std::vector<WidgetInfo>& items) const noexcept;
+
+        /**
+         * @brief - Similar to `hasUniformColumns` but for rows.
+         * @param items - the information about the items of the layout.
+         * @return - `true` if the rows can be computed in closed form.
+         */
+        bool
+        hasUniformRows(const std::vector<WidgetInfo>& items) const noexcept;
+
+        /**
+         * @brief - Closed form version of `adjustColumnsWidth` which can be used when the
+         *          columns are uniform. Each column receives a fair share of the available
+         *          width which is then constrained by the policy of each item in a single
+         *          pass: as all columns behave the same there is no space that can be
+         *          redistributed from one column to another.
+         * @param window - the available space for the layout.
+         * @param items - the information about the items of the layout.
+         * @param cells - the cells to update with the computed width.
+         * @return - the width of each column.
+         */
+        std::vector<float>
+        computeUniformColumnsWidth(const utils::Sizef& window,
+                                   const std::vector<WidgetInfo>& items,
+                                   std::vector<CellInfo>& cells) const;
+
+        /**
+         * @brief - Similar to `computeUniformColumnsWidth` but for rows.
+         * @param window - the available space for the layout.
+         * @param items - the information about the items of the layout.
+         * @param cells - the cells to update with the computed height.
+         * @return - the height of each row.
+         */
+        std::vector<float>
+        computeUniformRowsHeight(const utils::Sizef& window,
+                                 const std::vector<WidgetInfo>& items,
+                                 std::vector<CellInfo>& cells) const;
+
+        // Convenience record describing the outcome of the multi-cell solver.
+        // The `spans` counts the number of multi-cell items processed while
+        // `iterations` describes how many passes were needed. The `converged`
+        // is `false` if the iteration bound was reached before the lines got
+        // stable and the `overflow` represents the total size which could
+        // not be provided to the spanning items: these items are clamped to
+        // the space available in the lines they span.
+        struct SpanReport {
+          unsigned spans;
+          unsigned iterations;
+          bool converged;
+          float overflow;
+        };
+
+        /**
+         * @brief - Used to adjust the multi-cell items so that they span the columns
+         *          they are assigned to. Items are processed in increasing span order
+         *          so that the narrowest constraints are resolved first. If an item
+         *          cannot fit in the columns it spans (typically because of its minimum
+         *          size), the missing width is taken from the other columns and given
+         *          evenly to these columns and another pass is performed. The number of
+         *          passes is bounded by the `sk_maxSpanIterations` value.
+         *          The total width of the columns is never modified: the other columns
+         *          are not shrunk below their own minimum or the minimum of the items
+         *          they contain. If not enough space can be found, the item is clamped
+         *          to the width of its columns and the missing width is reported in the
+         *          `overflow` of the returned value.
+         *          Single-cell items located in columns which have been resized are
+         *          adjusted once the process is complete.
+         * @param columns - the width of each column, updated by this method.
+         * @param items - the information about the items of the layout.
+         * @param cells - the cells to update with the computed width.
+         * @return - a report describing how the process went.
+         */
+        SpanReport
+        adjustMultiCellWidth(std::vector<float>& columns,
                              const std::vector<WidgetInfo>& items,
                              std::vector<CellInfo>& cells);
 
-        void
-        adjustMultiCellHeight(const std::vector<float>& rows,
+        /**
+         * @brief - Similar to `adjustMultiCellWidth` but for rows.
+         * @param rows - the height of each row, updated by this method.
+         * @param items - the information about the items of the layout.
+         * @param cells - the cells to update with the computed height.
+         * @return - a report describing how the process went.
+         */
+        SpanReport
+        adjustMultiCellHeight(std::vector<float>& rows,
                               const std::vector<WidgetInfo>& items,
                               std::vector<CellInfo>& cells);
 
+        /**
+         * @brief - Used to enlarge the `span` lines starting at `first` by `excess`
+         *          by taking the space from the other lines. Lines are not shrunk
+         *          below their `floors` value so the space obtained might be smaller
+         *          than the `excess`.
+         * @param lines - the dimension of each line, updated by this method.
+         * @param floors - the minimum dimension of each line.
+         * @param first - the index of the first line to enlarge.
+         * @param span - the number of lines to enlarge.
+         * @param excess - the space needed by the lines to enlarge.
+         * @param resized - set to `true` for each line modified by this method.
+         * @return - the space given to the spanned lines.
+         */
+        float
+        redistributeSpanExcess(std::vector<float>& lines,
+                               const std::vector<float>& floors,
+                               unsigned first,
+                               unsigned span,
+                               float excess,
+                               std::vector<bool>& resized) const noexcept;
+
       private:
 
         friend std::hash<ItemDataWrapper>;
@@ -189,14 +342,35 @@ namespace sdl {
 
         using LocationsMap = std::unordered_map<int, ItemInfo>;
 
+        /**
+         * @brief - The maximum number of passes performed by the multi-cell solver
+         *          before giving up. This guarantees a predictable relayout time even
+         *          for grids with many overlapping spans.
+         */
+        static const unsigned sk_maxSpanIterations;
+
         unsigned m_columns;
         unsigned m_rows;
 
         std::vector<LineInfo> m_columnsInfo;
         std::vector<LineInfo> m_rowsInfo;
 
+        /**
+         * @brief - Whether the user declared the columns (respectively rows) of this
+         *          layout as uniform. When this is the case the closed form solver is
+         *          used without checking the items' constraints.
+         */
+        bool m_uniformColumns;
+        bool m_uniformRows;
+
         LocationsMap m_locations;
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Records the statistics of the geometry computations.
+         */
+        mutable LayoutStatsRecorder m_stats;
+# endif
     };
 
     using GridLayoutShPtr = std::shared_ptr<GridLayout>;
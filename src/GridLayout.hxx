@@ -98,6 +98,24 @@ namespace sdl {
       }
     }
 
+    inline
+    void
+    GridLayout::setUniformColumns(bool uniform) {
+      if (m_uniformColumns != uniform) {
+        m_uniformColumns = uniform;
+        makeGeometryDirty();
+      }
+    }
+
+    inline
+    void
+    GridLayout::setUniformRows(bool uniform) {
+      if (m_uniformRows != uniform) {
+        m_uniformRows = uniform;
+        makeGeometryDirty();
+      }
+    }
+
     inline
     void
     GridLayout::addItem(core::LayoutItem* container,
@@ -134,6 +152,25 @@ namespace sdl {
       resetGridInfo();
     }
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+    inline
+    const layout::Stats&
+    GridLayout::getStats() const noexcept {
+      return m_stats.getStats();
+    }
+
+    inline
+    void
+    GridLayout::dumpStatsTrace(const std::string& file) {
+      if (!m_stats.dumpTrace(file, getName())) {
+        error(
+          std::string("Could not dump layout statistics"),
+          std::string("Failed to write \"") + file + "\""
+        );
+      }
+    }
+# endif
+
     inline
     void
     GridLayout::resetGridInfo() {
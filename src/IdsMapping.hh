@@ -0,0 +1,202 @@
+#ifndef    IDS_MAPPING_HH
+# define   IDS_MAPPING_HH
+
+# include <vector>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Bidirectional association between the logical ids of the items of a
+     *          layout (i.e. their position as seen by the user) and their physical
+     *          ids (i.e. their position in the internal array of the base layout).
+     *          The items are kept in an order-statistic tree (a treap ordered by the
+     *          logical position) where each node is stored at the index of its
+     *          physical id. Each node knows the size of its subtree and its parent:
+     *          both conversions, insertions and removals at any position are thus
+     *          performed in logarithmic time (expected) regardless of the number of
+     *          items located after the modified position.
+     *          As layouts usually convert all their items once modified, the tree is
+     *          also flattened into direct tables once enough conversions went through
+     *          the tree since the last modification. Conversions are then constant
+     *          time until the next insertion or removal while the cost to rebuild
+     *          the tables is amortized over the conversions performed on the tree.
+     */
+    class IdsMapping {
+      public:
+
+        IdsMapping();
+
+        ~IdsMapping() = default;
+
+        int
+        size() const noexcept;
+
+        /**
+         * @brief - Retrieves the physical id associated to the input logical id.
+         * @param logicID - the logical id to convert.
+         * @return - the corresponding physical id or `-1` if the logical id is not
+         *           valid.
+         */
+        int
+        getPhysicalID(int logicID) const noexcept;
+
+        /**
+         * @brief - Retrieves the logical id associated to the input physical id.
+         * @param physID - the physical id to convert.
+         * @return - the corresponding logical id or `-1` if the physical id is not
+         *           registered.
+         */
+        int
+        getLogicalID(int physID) const noexcept;
+
+        /**
+         * @brief - Registers the `physID` at the logical position `logicID`. Items
+         *          located at or after this position are moved back by one.
+         *          Note that the logical id is clamped to the valid range.
+         * @param logicID - the logical position at which the item is inserted.
+         * @param physID - the physical id of the item.
+         * @return - the logical position at which the item was actually inserted.
+         */
+        int
+        insert(int logicID,
+               int physID);
+
+        /**
+         * @brief - Removes the item at the logical position `logicID`. Items located
+         *          after this position are moved forward by one. Nothing happens if
+         *          the logical id is not valid.
+         * @param logicID - the logical position of the item to remove.
+         */
+        void
+        erase(int logicID);
+
+      private:
+
+        /**
+         * @brief - Convenience structure describing a node of the tree. The links
+         *          are physical ids (i.e. indices in the nodes' array) and `-1` is
+         *          used for missing links. The `size` counts the nodes of the tree
+         *          rooted at this node and is `0` for unused nodes.
+         */
+        struct Node {
+          int left;
+          int right;
+          int parent;
+          int size;
+          unsigned priority;
+        };
+
+        /**
+         * @brief - Retrieves the number of nodes of the tree rooted at `node`.
+         * @param node - the root of the tree, might be `-1`.
+         * @return - the number of nodes in the tree.
+         */
+        int
+        sizeOf(int node) const noexcept;
+
+        /**
+         * @brief - Updates the size of the `node` from the size of its children.
+         * @param node - the node to update.
+         */
+        void
+        update(int node) noexcept;
+
+        /**
+         * @brief - Splits the tree rooted at `node` so that the `count` first items
+         *          are moved to the `left` tree and the others to the `right` tree.
+         * @param node - the root of the tree to split.
+         * @param count - the number of items to move to the `left` tree.
+         * @param left - output root of the tree holding the first items.
+         * @param right - output root of the tree holding the remaining items.
+         */
+        void
+        split(int node,
+              int count,
+              int& left,
+              int& right) noexcept;
+
+        /**
+         * @brief - Merges two trees where all the items of `left` are located
+         *          before the items of `right`.
+         * @param left - the root of the first tree.
+         * @param right - the root of the second tree.
+         * @return - the root of the merged tree.
+         */
+        int
+        merge(int left,
+              int right) noexcept;
+
+        /**
+         * @brief - Marks the direct tables as outdated after a modification.
+         */
+        void
+        invalidate() noexcept;
+
+        /**
+         * @brief - Used before a conversion to determine whether the direct tables
+         *          can be used. The tables are rebuilt from the tree if they are not
+         *          valid and enough conversions were performed on the tree since the
+         *          last modification.
+         * @return - `true` if the direct tables are valid.
+         */
+        bool
+        useTables() const;
+
+        /**
+         * @brief - Generates the priority of a new node. Priorities are pseudo
+         *          random so that the tree stays balanced whatever the order of
+         *          the insertions.
+         * @return - the priority to assign to a node.
+         */
+        unsigned
+        generatePriority() noexcept;
+
+      private:
+
+        /**
+         * @brief - The nodes of the tree indexed by physical id.
+         */
+        std::vector<Node> m_nodes;
+
+        /**
+         * @brief - The physical id of the root of the tree or `-1` if the mapping
+         *          is empty.
+         */
+        int m_root;
+
+        /**
+         * @brief - The state of the generator used to produce the priorities.
+         */
+        unsigned m_seed;
+
+        /**
+         * @brief - The number of conversions performed on the tree after which the
+         *          direct tables are rebuilt is the number of items divided by this
+         *          value.
+         */
+        static constexpr int sk_conversionsRatio = 8;
+
+        /**
+         * @brief - Direct tables holding for each logical id the corresponding
+         *          physical id and for each physical id the corresponding logical
+         *          id (or `-1` if it is not registered). These are only valid if
+         *          `m_tablesValid` is `true`.
+         */
+        mutable std::vector<int> m_logicToPhys;
+        mutable std::vector<int> m_physToLogic;
+        mutable bool m_tablesValid;
+
+        /**
+         * @brief - The number of conversions performed on the tree since the last
+         *          modification.
+         */
+        mutable int m_treeConversions;
+    };
+
+  }
+}
+
+# include "IdsMapping.hxx"
+
+#endif    /* IDS_MAPPING_HH */
@@ -0,0 +1,293 @@
+#ifndef    IDS_MAPPING_HXX
+# define   IDS_MAPPING_HXX
+
+# include "IdsMapping.hh"
+
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    IdsMapping::IdsMapping():
+      m_nodes(),
+      m_root(-1),
+      m_seed(0x9e3779b9u),
+
+      m_logicToPhys(),
+      m_physToLogic(),
+      m_tablesValid(true),
+      m_treeConversions(0)
+    {
+      // Nothing to do.
+    }
+
+    inline
+    int
+    IdsMapping::size() const noexcept {
+      return sizeOf(m_root);
+    }
+
+    inline
+    int
+    IdsMapping::getPhysicalID(int logicID) const noexcept {
+      if (logicID < 0 || logicID >= size()) {
+        return -1;
+      }
+
+      if (useTables()) {
+        return m_logicToPhys[logicID];
+      }
+
+      // Descend from the root using the size of the left subtrees to find
+      // the node at the requested position.
+      int node = m_root;
+      int remaining = logicID;
+
+      while (node >= 0) {
+        const int before = sizeOf(m_nodes[node].left);
+
+        if (remaining < before) {
+          node = m_nodes[node].left;
+        }
+        else if (remaining == before) {
+          return node;
+        }
+        else {
+          remaining -= (before + 1);
+          node = m_nodes[node].right;
+        }
+      }
+
+      return -1;
+    }
+
+    inline
+    int
+    IdsMapping::getLogicalID(int physID) const noexcept {
+      if (physID < 0 || physID >= static_cast<int>(m_nodes.size()) || m_nodes[physID].size == 0) {
+        return -1;
+      }
+
+      if (useTables()) {
+        return m_physToLogic[physID];
+      }
+
+      // The position of the node is the number of items located before it:
+      // these are the items of its left subtree and the ones of the left
+      // subtree of each ancestor reached from its right child.
+      int logic = sizeOf(m_nodes[physID].left);
+      int node = physID;
+
+      while (m_nodes[node].parent >= 0) {
+        const int parent = m_nodes[node].parent;
+
+        if (m_nodes[parent].right == node) {
+          logic += sizeOf(m_nodes[parent].left) + 1;
+        }
+
+        node = parent;
+      }
+
+      return logic;
+    }
+
+    inline
+    int
+    IdsMapping::insert(int logicID,
+                       int physID)
+    {
+      // Clamp the logical id so that the item is inserted either in the
+      // middle of the existing items or at one of the extremities.
+      const int logic = std::max(0, std::min(logicID, size()));
+
+      if (physID >= static_cast<int>(m_nodes.size())) {
+        m_nodes.resize(physID + 1, Node{-1, -1, -1, 0, 0u});
+      }
+
+      m_nodes[physID] = Node{-1, -1, -1, 1, generatePriority()};
+
+      int before = -1, after = -1;
+      split(m_root, logic, before, after);
+
+      m_root = merge(merge(before, physID), after);
+      m_nodes[m_root].parent = -1;
+
+      invalidate();
+
+      return logic;
+    }
+
+    inline
+    void
+    IdsMapping::erase(int logicID) {
+      if (logicID < 0 || logicID >= size()) {
+        return;
+      }
+
+      int before = -1, rest = -1;
+      split(m_root, logicID, before, rest);
+
+      int item = -1, after = -1;
+      split(rest, 1, item, after);
+
+      m_nodes[item] = Node{-1, -1, -1, 0, 0u};
+
+      m_root = merge(before, after);
+      if (m_root >= 0) {
+        m_nodes[m_root].parent = -1;
+      }
+
+      invalidate();
+    }
+
+    inline
+    int
+    IdsMapping::sizeOf(int node) const noexcept {
+      return (node < 0 ? 0 : m_nodes[node].size);
+    }
+
+    inline
+    void
+    IdsMapping::update(int node) noexcept {
+      m_nodes[node].size = sizeOf(m_nodes[node].left) + sizeOf(m_nodes[node].right) + 1;
+    }
+
+    inline
+    void
+    IdsMapping::split(int node,
+                      int count,
+                      int& left,
+                      int& right) noexcept
+    {
+      if (node < 0) {
+        left = -1;
+        right = -1;
+        return;
+      }
+
+      Node& n = m_nodes[node];
+
+      if (sizeOf(n.left) < count) {
+        // The node belongs to the left part: split its right subtree.
+        int first = -1;
+        split(n.right, count - sizeOf(n.left) - 1, first, right);
+
+        n.right = first;
+        if (first >= 0) {
+          m_nodes[first].parent = node;
+        }
+
+        left = node;
+      }
+      else {
+        // The node belongs to the right part: split its left subtree.
+        int second = -1;
+        split(n.left, count, left, second);
+
+        n.left = second;
+        if (second >= 0) {
+          m_nodes[second].parent = node;
+        }
+
+        right = node;
+      }
+
+      update(node);
+    }
+
+    inline
+    int
+    IdsMapping::merge(int left,
+                      int right) noexcept
+    {
+      if (left < 0) {
+        return right;
+      }
+      if (right < 0) {
+        return left;
+      }
+
+      // The node with the highest priority becomes the root of the merged
+      // tree which keeps the tree balanced.
+      if (m_nodes[left].priority > m_nodes[right].priority) {
+        const int child = merge(m_nodes[left].right, right);
+
+        m_nodes[left].right = child;
+        m_nodes[child].parent = left;
+        update(left);
+
+        return left;
+      }
+
+      const int child = merge(left, m_nodes[right].left);
+
+      m_nodes[right].left = child;
+      m_nodes[child].parent = right;
+      update(right);
+
+      return right;
+    }
+
+    inline
+    void
+    IdsMapping::invalidate() noexcept {
+      m_tablesValid = false;
+      m_treeConversions = 0;
+    }
+
+    inline
+    bool
+    IdsMapping::useTables() const {
+      if (m_tablesValid) {
+        return true;
+      }
+
+      ++m_treeConversions;
+      if (m_treeConversions <= size() / sk_conversionsRatio) {
+        return false;
+      }
+
+      // Flatten the tree with an in-order traversal.
+      m_logicToPhys.clear();
+      m_logicToPhys.reserve(size());
+      m_physToLogic.assign(m_nodes.size(), -1);
+
+      std::vector<int> ancestors;
+      int node = m_root;
+
+      while (node >= 0 || !ancestors.empty()) {
+        while (node >= 0) {
+          ancestors.push_back(node);
+          node = m_nodes[node].left;
+        }
+
+        node = ancestors.back();
+        ancestors.pop_back();
+
+        m_physToLogic[node] = static_cast<int>(m_logicToPhys.size());
+        m_logicToPhys.push_back(node);
+
+        node = m_nodes[node].right;
+      }
+
+      m_tablesValid = true;
+
+      return true;
+    }
+
+    inline
+    unsigned
+    IdsMapping::generatePriority() noexcept {
+      // Xorshift generator: the quality is enough to balance the tree.
+      m_seed ^= (m_seed << 13u);
+      m_seed ^= (m_seed >> 17u);
+      m_seed ^= (m_seed << 5u);
+
+      return m_seed;
+    }
+
+  }
+}
+
+#endif    /* IDS_MAPPING_HXX */
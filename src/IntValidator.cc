@@ -1,26 +1,40 @@
 
 # include "IntValidator.hh"
 # include <cmath>
-# include <core_utils/Conversion.hh>
-# include "Validator_utils.hxx"
+# include <cstdint>
 
 namespace sdl {
   namespace graphic {
 
     Validator::State
     IntValidator::validate(const std::string& input) const {
+      return evaluate(number::parse(input));
+    }
+
+    Validator::ContextShPtr
+    IntValidator::createContext() const {
+      return std::make_shared<NumberContext>();
+    }
+
+    void
+    IntValidator::validateRange(const std::string_view* inputs,
+                                std::size_t count,
+                                State* states) const
+    {
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        states[id] = evaluate(number::parse(inputs[id]));
+      }
+    }
+
+    Validator::State
+    IntValidator::evaluate(const number::Components& number) const noexcept {
       // Note: the actual implementation is based on what we found in the Qt repository
       // but refined in order to provide more precise analysis of intermediate and
       // invalid states. For more details, see here:
       // https://code.woboq.org/qt5/qtbase/src/gui/util/qvalidator.cpp.html.
-      // Try to convert the input string to an integer value: if this cannot be done
-      // we have a trivial case of an invalid input.
-      bool ok = false;
-      int val = utils::convert(input, 0, ok);
-
-      // Trivial case of the empty string which allows to safely access at least the
-      // first characters in later tests.
-      if (input.empty()) {
+
+      // Trivial case of the empty string.
+      if (number.size == 0u) {
         // Consider empty string as intermediate.
         return State::Intermediate;
       }
@@ -28,28 +42,46 @@ namespace sdl {
       // Check whether the input string has at least the right sign compared to the
       // range. In order to do that we want to check for the existence of the '-'
       // and '+' characters in the string.
-      if (m_lower >= 0 && input[0] == '-') {
+      if (m_lower >= 0 && number.sign == '-') {
         return State::Invalid;
       }
-      if (m_upper < 0 && input[0] == '+') {
+      if (m_upper < 0 && number.sign == '+') {
         return State::Invalid;
       }
 
-      // Check whether the string is composed of a single '-' or '+' character: the
-      // conversion fails on this type of string but it is considered intermediate
-      // instead of `Invalid` so we need to check that before using the result of
-      // the `ok` value.
-      if ((input[0] == '-' || input[0] == '+') && input.size() == 1u) {
+      // Check whether the string is composed of a single '-' or '+' character: this
+      // is not a number yet but it is considered intermediate instead of `Invalid`.
+      if (number.sign != '\0' && number.size == 1u) {
         return State::Intermediate;
       }
 
-      // Now we can check if the conversion was successful: if this is not the case
-      // it means that something is wrong with the input string and thus we can say
-      // that's it's invalid in regard of the range.
+      // Check whether the components describe an integer: any decimal separator,
+      // exponent or unexpected character makes the input invalid. The same goes
+      // for values which cannot be represented with an integer.
+      const std::uint64_t limit = (
+        number.sign == '-' ?
+        static_cast<std::uint64_t>(std::numeric_limits<int>::max()) + 1u :
+        static_cast<std::uint64_t>(std::numeric_limits<int>::max())
+      );
+
+      const bool ok =
+        number.invalid == 0u &&
+        !number.separator &&
+        !number.exponent &&
+        number.leadDigits > 0u &&
+        number.leadDigits - number.leadZeros <= number::maxDigits &&
+        number.lead <= limit
+      ;
+
+      // If this is not the case it means that something is wrong with the input
+      // string and thus we can say that's it's invalid in regard of the range.
       if (!ok) {
         return State::Invalid;
       }
 
+      const std::int64_t magnitude = static_cast<std::int64_t>(number.lead);
+      const int val = static_cast<int>(number.sign == '-' ? -magnitude : magnitude);
+
       // Detect valid cases.
       if (val >= m_lower && val <= m_upper) {
         return State::Valid;
@@ -59,10 +91,7 @@ namespace sdl {
       // to account for the '+' or '-' sign when determining the length. This
       // will be used when determining whether an input can be modified to
       // make it valid.
-      int digits = input.size();
-      if (input[0] == '-' || input[0] == '+') {
-        --digits;
-      }
+      int digits = static_cast<int>(number.leadDigits);
       int lowerDigits = (m_lower == 0 ? 1 : static_cast<int>(std::log10(std::abs(m_lower)) + 1));
       int upperDigits = (m_upper == 0 ? 1 : static_cast<int>(std::log10(std::abs(m_upper)) + 1));
 
@@ -5,6 +5,7 @@
 # include <string>
 # include <limits>
 # include "Validator.hh"
+# include "Validator_utils.hxx"
 
 namespace sdl {
   namespace graphic {
@@ -54,6 +55,47 @@ namespace sdl {
         State
         validate(const std::string& input) const override;
 
+        /**
+         * @brief - Reimplementation of the base `Validator` method to provide a context
+         *          able to hold the components of the number being edited.
+         * @return - a new context suited for this validator.
+         */
+        ContextShPtr
+        createContext() const override;
+
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to validate values
+         *          directly from their views, without copying them.
+         * @param inputs - pointer to the first value to validate.
+         * @param count - the number of values to validate.
+         * @param states - pointer to the first state to fill.
+         */
+        void
+        validateRange(const std::string_view* inputs,
+                      std::size_t count,
+                      State* states) const override;
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to indicate that
+         *          the validation does not modify this validator and can thus be run
+         *          concurrently.
+         * @return - `true`.
+         */
+        bool
+        canValidateConcurrently() const noexcept override;
+
+        /**
+         * @brief - Reimplementation of the base `Validator` method to produce the verdict
+         *          for the number described by the input components. This is where the
+         *          range of the validator is checked.
+         * @param number - the components of the number to validate.
+         * @return - a value among the enumeration to indicate the validity of the number.
+         */
+        State
+        evaluate(const number::Components& number) const noexcept override;
+
       private:
 
         /**
@@ -32,6 +32,12 @@ namespace sdl {
       m_lower = std::min(m_lower, m_upper);
     }
 
+    inline
+    bool
+    IntValidator::canValidateConcurrently() const noexcept {
+      return true;
+    }
+
   }
 }
 
@@ -27,7 +27,10 @@ namespace sdl {
 
       m_textChanged(true),
 
-      m_label(),
+      m_glyphsKey(),
+      m_glyphs(),
+      m_textSize(),
+      m_preloaded(),
 
       m_propsLocker()
     {}
@@ -66,7 +69,7 @@ namespace sdl {
 
       // If we don't have any text to display, return early, nothing more to
       // do for the drawing operation.
-      if (!m_label.valid()) {
+      if (m_text.empty() || !m_textSize.valid()) {
         return;
       }
 
@@ -97,7 +100,7 @@ namespace sdl {
 
       // Determine the position where the text should be blit, not considering
       // the input `area` nor the available space.
-      utils::Sizef sizeText = getEngine().queryTexture(m_label);
+      utils::Sizef sizeText = m_textSize;
       utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
 
       utils::Vector2f center;
@@ -138,21 +141,35 @@ namespace sdl {
         return;
       }
 
-      // Some part of the text is visible. We now need to determine which part.
-      // In order to do so we need to convert the `dstRectToUpdate` into the
-      // coordinate frame of the text to display. This can be done by expressing
-      // this area relatively to the `dstRect` itself as this area has the same
-      // scale as the text itself.
-      utils::Boxf srcRect = convertToLocal(dstRectToUpdate, dstRect);
-
-      // Convert both area to areas usable by the engine.
+      // Some part of the text is visible. We now need to draw each glyph which
+      // is at least partially visible. For each one of them we determine which
+      // part is visible by expressing the area to update relatively to the area
+      // covered by the glyph (which has the same scale as the glyph itself).
       utils::Boxf env = utils::Boxf::fromSize(sizeEnv, true);
 
-      utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, sizeText);
-      utils::Boxf dstRectEngine = convertToEngineFormat(dstRectToUpdate, env);
-
-      // Repaint the needed part of the text.
-      getEngine().drawTexture(m_label, &srcRectEngine, &uuid, &dstRectEngine);
+      m_glyphs->draw(
+        m_text,
+        m_textRole,
+        dstRect,
+        getEngine(),
+        m_font,
+        [this, &uuid, &area, &env](const GlyphCache::Glyph& glyph, const utils::Boxf& glyphRect) {
+          utils::Boxf glyphRectToUpdate = glyphRect.intersect(area);
+
+          if (!glyphRectToUpdate.valid()) {
+            return;
+          }
+
+          utils::Boxf srcRect = convertToLocal(glyphRectToUpdate, glyphRect);
+
+          // Convert both area to areas usable by the engine.
+          utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, glyph.size);
+          utils::Boxf dstRectEngine = convertToEngineFormat(glyphRectToUpdate, env);
+
+          // Repaint the needed part of the glyph.
+          getEngine().drawTexture(glyph.texture, &srcRectEngine, &uuid, &dstRectEngine);
+        }
+      );
     }
 
     void
@@ -3,8 +3,10 @@
 
 # include <memory>
 # include <string>
+# include <string_view>
 # include <core_utils/Uuid.hh>
 # include <sdl_core/SdlWidget.hh>
+# include "SharedGlyphs.hh"
 
 namespace sdl {
   namespace graphic {
@@ -47,6 +49,25 @@ namespace sdl {
         void
         setVerticalAlignment(const VerticalAlignment& alignment) noexcept;
 
+        /**
+         * @brief - Used to render in advance the glyphs for the provided characters so
+         *          that displaying a text composed of them later on does not require to
+         *          render anything. This is typically useful for labels displaying a
+         *          numeric value which is updated often (e.g. digits and decimal point).
+         * @param characters - the characters to render ahead of time.
+         */
+        void
+        preloadGlyphs(const std::string& characters) noexcept;
+
+        /**
+         * @brief - Used to retrieve the statistics of the cache used to render and
+         *          measure the text of this label. Note that the cache is shared with
+         *          the widgets using the same font.
+         * @return - the statistics of the text cache.
+         */
+        GlyphCache::Stats
+        getTextCacheStats() noexcept;
+
       protected:
 
         /**
@@ -75,14 +96,18 @@ namespace sdl {
 
       private:
 
+        /**
+         * @brief - Used to load the font if needed and to compute the size of the text
+         *          from the glyphs representing it. Missing glyphs are rendered but the
+         *          text itself is never rendered as a whole.
+         */
         void
         loadText();
 
         /**
-         * @brief - Destroys the texture contained in the `m_label` identifier if it is valid
-         *          and invalidate it.
-         *          Should typically be used when recreating the text after a modification of
-         *          the rendering mode.
+         * @brief - Releases the glyphs cache used by this label. The glyphs are destroyed
+         *          in case no other widget uses them. Should be used when the font is not
+         *          valid anymore.
          */
         void
         clearText();
@@ -125,8 +150,7 @@ namespace sdl {
          *          the provided option and displayed on the area available for this widget based
          *          on the alignments defined by the user.
          *          A modification of any of the properties or of the text itself triggers a
-         *          repaint operation which will recreate the text's texture. Such operations are
-         *          thus to be handled with care.
+         *          repaint operation which lays out the text again from the cached glyphs.
          */
         std::string m_text;
 
@@ -164,21 +188,33 @@ namespace sdl {
 
         /**
          * @brief - Used to perform some caching of the data for this label widget. As long as the
-         *          `m_textChanged` is set to `false` the content of `m_label` is considered valid
-         *          and is drawn as is upon each `drawContentPrivate` operation.
+         *          `m_textChanged` is set to `false` the content of `m_textSize` is considered valid
+         *          and is used as is upon each `drawContentPrivate` operation.
          *          As soon as this value is set to `true` the information contained in the various
-         *          engine-managed fields of the object (such as `m_label` or `m_font`) may not be
+         *          engine-managed fields of the object (such as `m_textSize` or `m_font`) may not be
          *          up-to-date with the content of the other attributes.
          *          This is corrected upon calling the `drawContentPrivate` method.
          */
         bool m_textChanged;
 
         /**
-         * @brief - An identifier provided by the engine and representing the texture containing the
-         *          rendered text for this label. As long as the `m_textChanged` boolean is set to
-         *          `false` this value can be cached and used as is.
+         * @brief - The glyphs used to draw the text of this label. Each character is only
+         *          rendered once (for each role) so that updating the text does not need
+         *          to render it again: this is especially useful for labels displaying a
+         *          value which changes often. The cache is shared with the other widgets
+         *          using the same font and is acquired along with the font.
+         *          The `m_textSize` holds the size of the text as laid out with the glyphs
+         *          and is valid as long as `m_textChanged` is `false`.
+         */
+        std::string m_glyphsKey;
+        SharedGlyphs::CacheShPtr m_glyphs;
+        utils::Sizef m_textSize;
+
+        /**
+         * @brief - The characters for which glyphs should be rendered even if they do not
+         *          appear in the current text. They are loaded along with the text.
          */
-        utils::Uuid m_label;
+        std::string m_preloaded;
 
         /**
          * @brief - Used to protect concurrent accesses to the internal data of this label widget.
@@ -10,10 +10,24 @@ namespace sdl {
     void
     LabelWidget::setText(const std::string& text) noexcept {
       const std::lock_guard guard(m_propsLocker);
+
+      // Avoid repainting the label if the text does not change.
+      if (m_text == text) {
+        return;
+      }
+
       m_text = text;
       setTextChanged();
     }
 
+    inline
+    void
+    LabelWidget::preloadGlyphs(const std::string& characters) noexcept {
+      const std::lock_guard guard(m_propsLocker);
+      m_preloaded = characters;
+      setTextChanged();
+    }
+
     inline
     void
     LabelWidget::setHorizontalAlignment(const HorizontalAlignment& alignment) noexcept {
@@ -28,14 +42,21 @@ namespace sdl {
       m_vAlignment = alignment;
     }
 
+    inline
+    GlyphCache::Stats
+    LabelWidget::getTextCacheStats() noexcept {
+      const std::lock_guard guard(m_propsLocker);
+      return (m_glyphs != nullptr ? m_glyphs->getStats() : GlyphCache::Stats{0u, 0u, 0u});
+    }
+
     inline
     void
     LabelWidget::loadText() {
-      // Clear existing label if any.
-      clearText();
+      // Reset the size of the text.
+      m_textSize = utils::Sizef();
 
       // Load the text.
-      if (!m_text.empty()) {
+      if (!m_text.empty() || !m_preloaded.empty()) {
         if (!m_font.valid()) {
           // Load the font.
           m_font = getEngine().createColoredFont(m_fontName, getPalette(), m_fontSize);
@@ -46,19 +67,29 @@ namespace sdl {
               std::string("Invalid null font")
             );
           }
+
+          // Use the glyphs shared by the widgets with the same font.
+          m_glyphsKey = SharedGlyphs::keyFromFont(m_fontName, m_fontSize, getPalette());
+          m_glyphs = SharedGlyphs::getInstance().acquire(getEngine(), m_glyphsKey);
         }
 
-        m_label = getEngine().createTextureFromText(m_text, m_font, m_textRole);
+        // Render the glyphs which are expected to be used so that the text can
+        // be changed without creating any texture.
+        m_glyphs->preload(m_preloaded, m_textRole, getEngine(), m_font);
+      }
+
+      if (!m_text.empty()) {
+        // Only the glyphs which were never used before need to be rendered.
+        m_textSize = m_glyphs->measure(m_text, m_textRole, getEngine(), m_font);
       }
     }
 
     inline
     void
     LabelWidget::clearText() {
-      if (m_label.valid()) {
-        getEngine().destroyTexture(m_label);
-        m_label.invalidate();
-      }
+      SharedGlyphs::getInstance().release(getEngine(), m_glyphs, m_glyphsKey);
+
+      m_textSize = utils::Sizef();
     }
 
     inline
@@ -0,0 +1,92 @@
+
+# include "LayoutStats.hh"
+
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+
+#  include <cstdio>
+#  include <fstream>
+
+namespace sdl {
+  namespace graphic {
+
+    const unsigned LayoutStatsRecorder::sk_maxTraceEvents = 65536u;
+
+    bool
+    LayoutStatsRecorder::dumpTrace(const std::string& file,
+                                   const std::string& name)
+    {
+      std::ofstream out(file);
+      if (!out.is_open()) {
+        return false;
+      }
+
+      // The name of the layout is provided by the user and can contain any
+      // character.
+      const std::string category = escape(name);
+
+      // Use the complete events (`X`) of the Chrome trace event format: each
+      // phase is described by its start time and its duration.
+      out << "{\"traceEvents\":[";
+
+      for (unsigned id = 0u ; id < m_events.size() ; ++id) {
+        out << (id > 0u ? "," : "")
+            << "{\"name\":\"" << escape(layout::getNameFromPhase(m_events[id].phase)) << "\","
+            << "\"cat\":\"" << category << "\","
+            << "\"ph\":\"X\","
+            << "\"ts\":" << m_events[id].start << ","
+            << "\"dur\":" << m_events[id].duration << ","
+            << "\"pid\":0,\"tid\":0}";
+      }
+
+      out << "]}" << std::endl;
+
+      m_events.clear();
+
+      return out.good();
+    }
+
+    std::string
+    LayoutStatsRecorder::escape(const std::string& str) {
+      std::string out;
+      out.reserve(str.size());
+
+      for (std::string::const_iterator it = str.cbegin() ; it != str.cend() ; ++it) {
+        const unsigned char c = static_cast<unsigned char>(*it);
+
+        switch (c) {
+          case '"':
+            out += "\\\"";
+            break;
+          case '\\':
+            out += "\\\\";
+            break;
+          case '\n':
+            out += "\\n";
+            break;
+          case '\r':
+            out += "\\r";
+            break;
+          case '\t':
+            out += "\\t";
+            break;
+          default:
+            if (c < 0x20u) {
+              // Other control characters use the generic escape sequence.
+              char buf[8];
+              std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+              out += buf;
+            }
+            else {
+              out += static_cast<char>(c);
+            }
+            break;
+        }
+      }
+
+      return out;
+    }
+
+  }
+}
+
+# endif
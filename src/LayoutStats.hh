@@ -0,0 +1,161 @@
+#ifndef    LAYOUT_STATS_HH
+# define   LAYOUT_STATS_HH
+
+/**
+ * @brief - Layouts can record statistics about their geometry computations when
+ *          the `SDL_GRAPHIC_LAYOUT_STATS` flag is defined. When this is not the
+ *          case the recording statements are removed by the preprocessor and the
+ *          layouts do not hold any additional data.
+ */
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+#  define LAYOUT_STATS(...) __VA_ARGS__
+# else
+#  define LAYOUT_STATS(...)
+# endif
+
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+
+#  include <array>
+#  include <chrono>
+#  include <string>
+#  include <vector>
+#  include <maths_utils/Size.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    namespace layout {
+
+      /**
+       * @brief - The phases of the geometry computation of a layout. Not all the
+       *          layouts go through all the phases.
+       */
+      enum class Phase {
+        ItemsInfo,
+        Constraints,
+        Columns,
+        Rows,
+        MultiCell,
+        Positioning,
+        Count
+      };
+
+      std::string
+      getNameFromPhase(const Phase& phase) noexcept;
+
+      /**
+       * @brief - Statistics describing the last geometry computation of a layout.
+       *          The `computations` counts all the geometry computations performed
+       *          since the creation of the layout while the other values describe
+       *          the last one. Durations are expressed in milliseconds.
+       */
+      struct Stats {
+        unsigned computations;
+        std::array<float, static_cast<unsigned>(Phase::Count)> durations;
+        unsigned iterations;
+        unsigned minClamps;
+        unsigned maxClamps;
+      };
+
+    }
+
+    class LayoutStatsRecorder {
+      public:
+
+        LayoutStatsRecorder();
+
+        ~LayoutStatsRecorder() = default;
+
+        const layout::Stats&
+        getStats() const noexcept;
+
+        /**
+         * @brief - Used to indicate that a new geometry computation starts. Resets
+         *          the statistics related to the last computation.
+         */
+        void
+        start() noexcept;
+
+        /**
+         * @brief - Used to indicate that the `phase` just ended. The time elapsed since
+         *          the end of the previous phase (or the start of the computation) is
+         *          attributed to it.
+         * @param phase - the phase which just ended.
+         */
+        void
+        phase(const layout::Phase& phase);
+
+        /**
+         * @brief - Used to indicate that a new iteration of a fairness loop is starting.
+         */
+        void
+        iteration() noexcept;
+
+        /**
+         * @brief - Used to determine whether an item with the final `size` has been
+         *          clamped by its minimum or maximum size and to count it if needed.
+         * @param size - the size assigned to the item.
+         * @param min - the minimum size of the item.
+         * @param max - the maximum size of the item.
+         */
+        void
+        clamp(const utils::Sizef& size,
+              const utils::Sizef& min,
+              const utils::Sizef& max) noexcept;
+
+        /**
+         * @brief - Dumps the recorded phases in a file using the Chrome trace event
+         *          format. Such a file can be loaded in `chrome://tracing`. The events
+         *          are cleared once dumped.
+         * @param file - the path to the output file.
+         * @param name - the name of the layout, used as the category of the events.
+         * @return - `true` if the file could be written.
+         */
+        bool
+        dumpTrace(const std::string& file,
+                  const std::string& name);
+
+      private:
+
+        using Clock = std::chrono::steady_clock;
+
+        /**
+         * @brief - Used to escape the input string so that it can be written as a
+         *          JSON string: quotes, backslashes and control characters are
+         *          replaced by their escape sequence.
+         * @param str - the string to escape.
+         * @return - the escaped string.
+         */
+        static
+        std::string
+        escape(const std::string& str);
+
+        /**
+         * @brief - Convenience structure describing a single trace event. Times are
+         *          expressed in microseconds.
+         */
+        struct TraceEvent {
+          layout::Phase phase;
+          long long start;
+          long long duration;
+        };
+
+        /**
+         * @brief - The maximum number of events kept in memory before being dumped. Any
+         *          event recorded after that will be discarded.
+         */
+        static const unsigned sk_maxTraceEvents;
+
+        layout::Stats m_stats;
+        Clock::time_point m_mark;
+        std::vector<TraceEvent> m_events;
+    };
+
+  }
+}
+
+#  include "LayoutStats.hxx"
+
+# endif
+
+#endif    /* LAYOUT_STATS_HH */
@@ -0,0 +1,101 @@
+#ifndef    LAYOUT_STATS_HXX
+# define   LAYOUT_STATS_HXX
+
+# include "LayoutStats.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    namespace layout {
+
+      inline
+      std::string
+      getNameFromPhase(const Phase& phase) noexcept {
+        switch (phase) {
+          case Phase::ItemsInfo:
+            return std::string("items_info");
+          case Phase::Constraints:
+            return std::string("constraints");
+          case Phase::Columns:
+            return std::string("columns");
+          case Phase::Rows:
+            return std::string("rows");
+          case Phase::MultiCell:
+            return std::string("multi_cell");
+          case Phase::Positioning:
+            return std::string("positioning");
+          default:
+            return std::string("unknown_phase");
+        }
+      }
+
+    }
+
+    inline
+    LayoutStatsRecorder::LayoutStatsRecorder():
+      m_stats(layout::Stats{0u, {}, 0u, 0u, 0u}),
+      m_mark(Clock::now()),
+      m_events()
+    {
+      // Nothing to do.
+    }
+
+    inline
+    const layout::Stats&
+    LayoutStatsRecorder::getStats() const noexcept {
+      return m_stats;
+    }
+
+    inline
+    void
+    LayoutStatsRecorder::start() noexcept {
+      ++m_stats.computations;
+      m_stats.durations.fill(0.0f);
+      m_stats.iterations = 0u;
+      m_stats.minClamps = 0u;
+      m_stats.maxClamps = 0u;
+
+      m_mark = Clock::now();
+    }
+
+    inline
+    void
+    LayoutStatsRecorder::phase(const layout::Phase& phase) {
+      const Clock::time_point now = Clock::now();
+
+      const long long start = std::chrono::duration_cast<std::chrono::microseconds>(m_mark.time_since_epoch()).count();
+      const long long duration = std::chrono::duration_cast<std::chrono::microseconds>(now - m_mark).count();
+
+      m_stats.durations[static_cast<unsigned>(phase)] += duration / 1000.0f;
+
+      if (m_events.size() < sk_maxTraceEvents) {
+        m_events.push_back(TraceEvent{phase, start, duration});
+      }
+
+      m_mark = now;
+    }
+
+    inline
+    void
+    LayoutStatsRecorder::iteration() noexcept {
+      ++m_stats.iterations;
+    }
+
+    inline
+    void
+    LayoutStatsRecorder::clamp(const utils::Sizef& size,
+                               const utils::Sizef& min,
+                               const utils::Sizef& max) noexcept
+    {
+      if (min.isValid() && (size.w() <= min.w() || size.h() <= min.h())) {
+        ++m_stats.minClamps;
+      }
+      if (max.isValid() && (size.w() >= max.w() || size.h() >= max.h())) {
+        ++m_stats.maxClamps;
+      }
+    }
+
+  }
+}
+
+#endif    /* LAYOUT_STATS_HXX */
@@ -35,6 +35,8 @@ namespace sdl {
       // for vertical layout) unless other indications are specified in the
       // item's size policy.
 
+      LAYOUT_STATS(m_stats.start());
+
       // First, we need to compute the available size for this layout. We need
       // to take into account margins.
       const utils::Sizef internalSize = computeAvailableSize(window);
@@ -43,6 +45,8 @@ namespace sdl {
       // requesting constantly information or setting information multiple times.
       std::vector<WidgetInfo> itemsInfo = computeItemsInfo();
 
+      LAYOUT_STATS(m_stats.phase(layout::Phase::ItemsInfo));
+
       notice("Available size: " + std::to_string(window.w()) + "x" + std::to_string(window.h()));
       notice("Internal size: " + std::to_string(internalSize.w()) + "x" + std::to_string(internalSize.h()));
 
@@ -76,6 +80,7 @@ namespace sdl {
       // Loop until no more items can be used to adjust the space needed or all the
       // available space has been used up.
       while (!itemsToAdjust.empty() && !allSpaceUsed) {
+        LAYOUT_STATS(m_stats.iteration());
 
         // Compute the amount of space we will try to allocate to each item still
         // available for adjustment.
@@ -180,6 +185,9 @@ namespace sdl {
         warn("Could only achieve size of " + achievedSize.toString() + " but available space is " + window.toString());
       }
 
+      // The flow direction of the layout is the one solved by the fairness loop.
+      LAYOUT_STATS(m_stats.phase(getDirection() == Direction::Horizontal ? layout::Phase::Columns : layout::Phase::Rows));
+
       // All items have suited dimensions, we can now handle the position of each
       // item. We basically just move each item side by side based on their
       // dimensions and adding margins.
@@ -211,6 +219,8 @@ namespace sdl {
         outputBoxes[index].x() = xItem;
         outputBoxes[index].y() = yItem;
 
+        LAYOUT_STATS(m_stats.clamp(outputBoxes[index].toSize(), itemsInfo[index].min, itemsInfo[index].max));
+
         // Update the position for the next item based on the layout's
         // direction.
         if (getDirection() == Direction::Horizontal) {
@@ -226,6 +236,8 @@ namespace sdl {
 
       // Assign the rendering area to items.
       assignRenderingAreas(outputBoxes, window);
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Positioning));
     }
 
     void
@@ -261,22 +273,11 @@ namespace sdl {
       // In all 3 cases we need to relabel the items which come after the
       // newly inserted item so that we keep some kind of consistency.
 
-      // First, normalize the index: don't forget that the current size of
-      // the layout *includes* the item we want to insert (because `addItem`
-      // has already been called).
-      int normalized = utils::clamp(0, index, getItemsCount() - 1);
-
-      // Update the label of existing items if it exceeds the new desired
-      // logical index.
-      for (unsigned id = 0u ; id < m_idsToPosition.size() ; ++id) {
-        if (m_idsToPosition[id] >= normalized) {
-          ++m_idsToPosition[id];
-        }
-      }
-
-      // Now we have a valid set of labels with a hole at the position the
-      // new `item` should be inserted: let's fix that.
-      m_idsToPosition.insert(m_idsToPosition.cbegin() + normalized, physID);
+      // The associations table takes care of normalizing the index and of
+      // relabeling the items located after the new one: don't forget that
+      // the current size of the layout *includes* the item we want to insert
+      // (because `addItem` has already been called).
+      m_idsToPosition.insert(utils::clamp(0, index, getItemsCount() - 1), physID);
     }
 
     bool
@@ -284,24 +285,9 @@ namespace sdl {
                                  int /*physID*/)
     {
       // Now update the local information by removing the input item from the internal
-      // table. We basically copy all the information except for the deleted item.
-      // Note that the internal `m_idsToPosition` will be left unchanged for values
-      // smaller than `rmLogicID` and shifted by one for value larger than that.
-      IdToPosition newIDs(m_idsToPosition.size() - 1);
-      for (int id = 0 ; id < static_cast<int>(m_idsToPosition.size()) ; ++id) {
-        if (id < logicID) {
-          newIDs[id] = m_idsToPosition[id];
-        }
-        else if (id == logicID) {
-          // Ignore this item as it will be deleted.
-        }
-        else {
-          newIDs[id - 1] = m_idsToPosition[id];
-        }
-      }
-
-      // Swap with the internal array.
-      m_idsToPosition.swap(newIDs);
+      // table. Note that the internal `m_idsToPosition` will be left unchanged for
+      // values smaller than `logicID` and shifted by one for value larger than that.
+      m_idsToPosition.erase(logicID);
 
       // Update the layout as an item has been removed.
       return true;
@@ -6,6 +6,8 @@
 # include <maths_utils/Size.hh>
 # include <sdl_core/Layout.hh>
 # include <sdl_core/SizePolicy.hh>
+# include "IdsMapping.hh"
+# include "LayoutStats.hh"
 
 namespace sdl {
   namespace graphic {
@@ -53,6 +55,24 @@ namespace sdl {
         float
         getComponentMargin() const noexcept;
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Retrieves the statistics recorded during the last geometry
+         *          computation of this layout.
+         * @return - the statistics of this layout.
+         */
+        const layout::Stats&
+        getStats() const noexcept;
+
+        /**
+         * @brief - Dumps the phases recorded since the last dump in the Chrome trace
+         *          event format. Raises an error if the file cannot be written.
+         * @param file - the path to the output file.
+         */
+        void
+        dumpStatsTrace(const std::string& file);
+# endif
+
       protected:
 
         void
@@ -62,9 +82,8 @@ namespace sdl {
 
         /**
          * @brief - Reimplementation of the base `Layout` method in order to associate
-         *          the logical id to the physical id. This method basically traverses
-         *          the internal array of associations and try to find the corresponding
-         *          id.
+         *          the logical id to the physical id using the internal table of
+         *          associations.
          * @param physID - the physical id for which the logical id should be returned.
          * @return - an logical index which corresponds to the input physical id or a
          *           negative value if no such index exists in the layout.
@@ -106,8 +125,6 @@ namespace sdl {
 
       private:
 
-        using IdToPosition = std::vector<int>;
-
         Direction m_direction;
         float m_componentMargin;
 
@@ -115,8 +132,17 @@ namespace sdl {
          * @brief - Allows to store the logical position of the item stored at a given
          *          position in the parent table. This allows to correctly assign the
          *          rendering area to widgets based on their index in the layout.
+         *          Both directions of the association are indexed so that lookups
+         *          do not need to traverse the table.
+         */
+        IdsMapping m_idsToPosition;
+
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Records the statistics of the geometry computations.
          */
-        IdToPosition m_idsToPosition;
+        mutable LayoutStatsRecorder m_stats;
+# endif
     };
 
     using LinearLayoutShPtr = std::shared_ptr<LinearLayout>;
@@ -31,35 +31,37 @@ namespace sdl {
       return m_componentMargin;
     }
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
     inline
-    int
-    LinearLayout::getLogicalIDFromPhysicalID(int physID) const noexcept {
-      // Assume we can't find the logical id.
-      int logicID = -1;
-
-      // Traverse the internal array of associations.
-      int id = 0;
-      while (id < static_cast<int>(m_idsToPosition.size()) && logicID < 0) {
-        if (m_idsToPosition[id] == physID) {
-          logicID = id;
-        }
-        ++id;
+    const layout::Stats&
+    LinearLayout::getStats() const noexcept {
+      return m_stats.getStats();
+    }
+
+    inline
+    void
+    LinearLayout::dumpStatsTrace(const std::string& file) {
+      if (!m_stats.dumpTrace(file, getName())) {
+        error(
+          std::string("Could not dump layout statistics"),
+          std::string("Failed to write \"") + file + "\""
+        );
       }
+    }
+# endif
 
-      // Return the logical id, either valid or invalid.
-      return logicID;
+    inline
+    int
+    LinearLayout::getLogicalIDFromPhysicalID(int physID) const noexcept {
+      // The logical id is directly given by the associations table.
+      return m_idsToPosition.getLogicalID(physID);
     }
 
     inline
     int
     LinearLayout::getPhysicalIDFromLogicalID(int logicID) const noexcept {
-      // Check whether the input logical id seems valid.
-      if (logicID < 0 || logicID >= static_cast<int>(m_idsToPosition.size())) {
-        return -1;
-      }
-
       // The physical id is directly given by the associations table.
-      return m_idsToPosition[logicID];
+      return m_idsToPosition.getPhysicalID(logicID);
     }
 
     inline
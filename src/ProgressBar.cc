@@ -1,7 +1,5 @@
 
 # include "ProgressBar.hh"
-# include "LinearLayout.hh"
-# include "GradientWidget.hh"
 
 namespace sdl {
   namespace graphic {
@@ -13,154 +11,146 @@ namespace sdl {
 
       m_propsLocker(),
 
-      m_completion(0.0f)
+      m_completion(0.0f),
+      m_repaintRequested(false),
+
+      m_gradient(nullptr),
+
+      m_texturesChanged(true),
+      m_gradientTex(),
+      m_emptyTex()
     {
       build();
     }
 
     void
     ProgressBar::setCompletion(float value) {
-      // Protect from concurrent accesses.
-      const std::lock_guard guard(m_propsLocker);
-
-      // Assign the progression if it is different.
-      bool changed = false;
+      // The completion is only read when painting the bar: we only need to
+      // store it and make sure that a repaint will happen.
       float newComp = std::max(0.0f, std::min(1.0f, value));
 
-      if (m_completion != newComp) {
-        verbose("Progression is now " + std::to_string(newComp) + " (from " + std::to_string(m_completion) + ")");
-
-        m_completion = newComp;
-        changed = true;
+      if (m_completion.exchange(newComp) == newComp) {
+        return;
       }
 
-      // Request a repaint and an update of the masking element if the internal
-      // completion value has changed.
-      if (changed) {
-        updateMaskSizeFromCompletion();
+      // Request a repaint unless one is already pending: it will use the most
+      // recent value anyway.
+      if (!m_repaintRequested.exchange(true)) {
         requestRepaint();
       }
     }
 
     void
-    ProgressBar::build() {
-      // No focus for this elements.
-      setFocusPolicy(core::FocusPolicy());
+    ProgressBar::drawContentPrivate(const utils::Uuid& uuid,
+                                    const utils::Boxf& area)
+    {
+      // Protect from concurrent accesses.
+      const std::lock_guard guard(m_propsLocker);
 
-      // Create a linear layout which will contain both the gradient
-      // widget representing the progression of the loading and the
-      // mask widget which will be used to `fake` some not-loaded
-      // part of the gradient.
-      LinearLayoutShPtr layout = std::make_shared<LinearLayout>(
-        "layout_for_progress_bar",
-        this,
-        LinearLayout::Direction::Horizontal,
-        getFrameDimensions()
-      );
+      // Any update of the completion from now on needs a new repaint.
+      m_repaintRequested = false;
+      const float completion = m_completion;
 
-      if (layout == nullptr) {
-        error(
-          std::string("Could not create progress bar"),
-          std::string("Cannot build layout")
-        );
+      // Create the textures if needed.
+      if (m_texturesChanged) {
+        loadTextures();
+        m_texturesChanged = false;
       }
 
-      setLayout(layout);
+      if (!m_gradientTex.valid() || !m_emptyTex.valid()) {
+        return;
+      }
+
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+      utils::Boxf env = utils::Boxf::fromSize(sizeEnv, true);
+
+      // The left part of the bar is the part that is completed.
+      utils::Boxf bar = getBarArea();
 
-      // Create the gradient and its corresponding widget to represent
-      // the progress bar.
-      core::engine::GradientShPtr gradient = std::make_shared<core::engine::Gradient>(
+      const float completed = completion * bar.w();
+      const float remaining = bar.w() - completed;
+
+      utils::Boxf completedPart(bar.getLeftBound() + completed / 2.0f, bar.y(), completed, bar.h());
+      utils::Boxf remainingPart(bar.getRightBound() - remaining / 2.0f, bar.y(), remaining, bar.h());
+
+      drawPartOnCanvas(m_gradientTex, bar, completedPart, uuid, env, area);
+      drawPartOnCanvas(m_emptyTex, bar, remainingPart, uuid, env, area);
+    }
+
+    void
+    ProgressBar::build() {
+      // No focus for this elements.
+      setFocusPolicy(core::FocusPolicy());
+
+      // Create the gradient to represent the completed part of the bar.
+      m_gradient = std::make_shared<core::engine::Gradient>(
         "gradient_for_progress_bar",
         core::engine::gradient::Mode::Linear,
         core::engine::Color::NamedColor::Red,
         core::engine::Color::NamedColor::Green
       );
+    }
 
-      GradientWidget* gradWidget = new GradientWidget(
-        "grad_for_progress_bar",
-        gradient,
-        this
-      );
-      if (gradWidget == nullptr) {
-        error(
-          std::string("Could not create progress bar"),
-          std::string("Cannot build gradient")
-        );
+    void
+    ProgressBar::loadTextures() {
+      // Clear existing textures if any.
+      clearTextures();
+
+      utils::Sizef size = getBarArea().toSize();
+      if (!size.valid()) {
+        return;
       }
 
-      // Create the mask used to hide part of the gradient in case the
-      // completion is not set to maximum for the progress bar.
-      core::SdlWidget* mask = new core::SdlWidget(
-        getMaskName(),
-        utils::Sizef(),
-        this,
-        core::engine::Color::NamedColor::White
+      // Use a brush to paint the gradient over the whole bar: only the part
+      // corresponding to the completion will be drawn.
+      core::engine::BrushShPtr bGradient = std::make_shared<core::engine::Brush>("grad_brush", size);
+      bGradient->drawGradient(*m_gradient);
+
+      m_gradientTex = getEngine().createTextureFromBrush(bGradient);
+
+      // Create the plain texture representing the remaining part.
+      core::engine::BrushShPtr bEmpty = std::make_shared<core::engine::Brush>(
+        std::string("empty_brush_for_") + getName(),
+        false
       );
-      if (mask == nullptr) {
+      bEmpty->setClearColor(core::engine::Color::NamedColor::White);
+      bEmpty->create(size, true);
+
+      m_emptyTex = getEngine().createTextureFromBrush(bEmpty);
+
+      if (!m_gradientTex.valid() || !m_emptyTex.valid()) {
         error(
-          std::string("Could not create progress bar"),
-          std::string("Cannot build progress mask")
+          std::string("Could not load progress bar visuals"),
+          std::string("Unable to create textures for \"") + m_gradient->getName() + "\""
         );
       }
-      mask->setZOrder(1);
-      mask->setFocusPolicy(core::FocusPolicy());
-      mask->setAllowLog(false);
-
-      // Add only the gradient widget to the layout, the masking element
-      // is handled manually as we want some sort of overlapping between
-      // both elements.
-      layout->addItem(gradWidget);
-
-      // Theoretically we should update the mask size to ensure the empty
-      // initial completion. BUT as we might not have a queue yet the event
-      // might not be able to be posted anyway.
-      // Anyway as we should get a resize event quite early in the process
-      // and as we already set the `m_completion·` to be `0` it should be
-      // automatically enforced when the resize event is received. So we
-      // will consider the job done here.
+
+      getEngine().fillTexture(m_gradientTex, getPalette());
     }
 
     void
-    ProgressBar::updateMaskSizeFromCompletion() {
-      // Given that the gradient widget is given all the available space on this
-      // widget we can assume that we are able to know its size through querying
-      // this widget's size.
-      // Now the goal is to resize the masking element so that it's size hides a
-      // part of the gradient widget consistent with the current completion value.
-      // By resizing it upon each progression notification we are able to fake
-      // a feeling of progress.
-      utils::Sizef window = LayoutItem::getRenderingArea().toSize();
-
-      // Compute the masked part of the widget: this corresponds to the part that
-      // it is not completed yet. We consider that the left part of the progress
-      // bar is the part that is completed.
-      float masked = std::min(1.0f, std::max(0.0f, 1.0f - m_completion));
-
-      utils::Sizef dims(masked * window.w(), window.h());
-      utils::Vector2f center(window.w() / 2.0f - dims.w() / 2.0f, 0.0f);
-
-      // Create the resize event for the mask. Note that in case the mask is
-      // set with a null width (typically when the percentage reaches `100%`
-      // we will instead hide the mask.
-      core::SdlWidget* mask = getMask();
-
-      if (dims.w() < 1.0f) {
-        mask->setVisible(false);
-      }
-      else {
-        // Make the mask visible if needed.
-        if (!mask->isVisible()) {
-          mask->setVisible(true);
-        }
-
-        postEvent(
-          std::make_shared<core::engine::ResizeEvent>(
-            utils::Boxf(center, dims),
-            mask->getRenderingArea(),
-            mask
-          )
-        );
+    ProgressBar::drawPartOnCanvas(const utils::Uuid& tex,
+                                  const utils::Boxf& bar,
+                                  const utils::Boxf& part,
+                                  const utils::Uuid& canvas,
+                                  const utils::Boxf& env,
+                                  const utils::Boxf& toUpdate)
+    {
+      // Clip the part to draw with the area to update.
+      utils::Boxf dst = part.intersect(toUpdate);
+
+      if (!dst.valid()) {
+        return;
       }
+
+      // The texture covers the whole bar: express the area to draw relatively
+      // to the bar to get the corresponding part of the texture.
+      utils::Boxf src = convertToLocal(dst, bar);
+
+      utils::Boxf srcEngine = convertToEngineFormat(src, bar.toSize());
+      utils::Boxf dstEngine = convertToEngineFormat(dst, env);
+
+      getEngine().drawTexture(tex, &srcEngine, &canvas, &dstEngine);
     }
 
   }
@@ -2,9 +2,11 @@
 # define   PROGRESS_BAR_HH
 
 # include <mutex>
+# include <atomic>
 # include <memory>
 # include <string>
 # include <sdl_core/SdlWidget.hh>
+# include <sdl_engine/Gradient.hh>
 
 namespace sdl {
   namespace graphic {
@@ -19,6 +21,9 @@ namespace sdl {
          *          In the part of the widget representing the `not-loaded` section
          *          a white color is used. The progress bar is represented into a
          *          light grey frame.
+         *          The bar is painted directly by this widget: the completed part is
+         *          a sub-rectangle of a gradient texture created once for the size of
+         *          the bar so that a progress does not require any layout update.
          * @param name - the name of the progress bar.
          * @param parent - the parent of this widget.
          * @param hint - the size hint of this item.
@@ -35,8 +40,11 @@ namespace sdl {
         /**
          * @brief - Used to assign a new completion percentage for this progress bar.
          *          The percentage is clamped in the valid range `[0; 1]`.
-         *          A repaint event is triggered if the value is effectively different
-         *          from the one kept internally.
+         *          This method does not acquire any lock and can be called often from
+         *          worker threads: a repaint is requested if the value is effectively
+         *          different from the one kept internally and if no repaint is already
+         *          pending. The value is only read when the bar is painted so a single
+         *          repaint is issued no matter how many updates happen in a frame.
          * @param value - the new completion percentage.
          */
         void
@@ -45,13 +53,24 @@ namespace sdl {
       protected:
 
         /**
-         * @brief - Reimplementation of the base class method to provide update of the
-         *          size of the mask as it is not managed by the layout itself.
+         * @brief - Reimplementation of the base class method to create again the
+         *          textures used to represent the bar with the new size.
          * @param window - the available size to perform the update.
          */
         void
         updatePrivate(const utils::Boxf& window) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. The completed part
+         *          of the bar is drawn from the gradient texture and the rest from a
+         *          plain texture, both clipped to the area to update.
+         * @param uuid - the identifier of the canvas which we can use to draw the bar.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
       private:
 
         /**
@@ -66,36 +85,50 @@ namespace sdl {
         getFrameDimensions() noexcept;
 
         /**
-         * @brief - Used to retrieve the name to use to describe the masking element.
-         * @return - a name to use to describe the masking element.
+         * @brief - Used to build the internal state of this widget.
          */
-        static
-        const char*
-        getMaskName() noexcept;
+        void
+        build();
 
         /**
-         * @brief - Used to build the layout of this widget.
+         * @brief - Used to compute the area covered by the bar (i.e. this widget without
+         *          its frame) in local coordinates.
+         * @return - the area of the bar.
+         */
+        utils::Boxf
+        getBarArea() const noexcept;
+
+        /**
+         * @brief - Creates the gradient and the plain textures with the size of the bar.
+         *          Assumes that the locker is already acquired.
          */
         void
-        build();
+        loadTextures();
 
         /**
-         * @brief - Compute and assign a valid size to the mask element used by this
-         *          progress bar to simulate some progress. The current size of the
-         *          widget is used.
+         * @brief - Destroys the textures created by `loadTextures`.
          *          Assumes that the locker is already acquired.
          */
         void
-        updateMaskSizeFromCompletion();
+        clearTextures();
 
         /**
-         * @brief - Used to retrieve the mask widget used to fake the loading progress.
-         *          The return value is always valid if the method returns (i.e. an error
-         *          is raised if the mask cannot be retrieved).
-         * @return - the masking element.
+         * @brief - Draws the part of a texture covering the whole `bar` which lies in the
+         *          `part` and in the area to update.
+         * @param tex - the texture to draw, as large as the `bar`.
+         * @param bar - the area covered by the texture in local coordinates.
+         * @param part - the part of the texture to draw in local coordinates.
+         * @param canvas - the texture onto which the texture should be drawn.
+         * @param env - the area of the canvas.
+         * @param toUpdate - the part of the canvas to update.
          */
-        core::SdlWidget*
-        getMask();
+        void
+        drawPartOnCanvas(const utils::Uuid& tex,
+                         const utils::Boxf& bar,
+                         const utils::Boxf& part,
+                         const utils::Uuid& canvas,
+                         const utils::Boxf& env,
+                         const utils::Boxf& toUpdate);
 
       private:
 
@@ -108,9 +141,29 @@ namespace sdl {
         /**
          * @brief - Holds the current completion percentage for this progress bar. Used
          *          to determine whether a new call to `setCompletion` should trigger a
-         *          repaint.
+         *          repaint. It is written without acquiring the locker.
+         */
+        std::atomic<float> m_completion;
+
+        /**
+         * @brief - Indicates that a repaint was requested and not performed yet. Further
+         *          updates of the completion do not need to request another one.
+         */
+        std::atomic_bool m_repaintRequested;
+
+        /**
+         * @brief - The gradient used to represent the completed part of the bar.
+         */
+        core::engine::GradientShPtr m_gradient;
+
+        /**
+         * @brief - The textures representing the completed and the remaining part of the
+         *          bar. They cover the whole bar and are created again only when the size
+         *          of the widget changes (as indicated by `m_texturesChanged`).
          */
-        float m_completion;
+        bool m_texturesChanged;
+        utils::Uuid m_gradientTex;
+        utils::Uuid m_emptyTex;
     };
 
     using ProgressBarShPtr = std::shared_ptr<ProgressBar>;
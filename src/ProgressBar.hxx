@@ -7,7 +7,11 @@ namespace sdl {
   namespace graphic {
 
     inline
-    ProgressBar::~ProgressBar() {}
+    ProgressBar::~ProgressBar() {
+      const std::lock_guard guard(m_propsLocker);
+
+      clearTextures();
+    }
 
     inline
     float
@@ -15,26 +19,42 @@ namespace sdl {
       return 5.0f;
     }
 
-    inline
-    const char*
-    ProgressBar::getMaskName() noexcept {
-      return "progress_mask";
-    }
-
     inline
     void
     ProgressBar::updatePrivate(const utils::Boxf& window) {
       // Call the base class method.
       core::SdlWidget::updatePrivate(window);
 
-      // Update the size of the mask to be consistent with the current state.
-      updateMaskSizeFromCompletion();
+      // The textures should be created again with the new size.
+      const std::lock_guard guard(m_propsLocker);
+      m_texturesChanged = true;
     }
 
     inline
-    core::SdlWidget*
-    ProgressBar::getMask() {
-      return getChildAs<core::SdlWidget>(getMaskName());
+    utils::Boxf
+    ProgressBar::getBarArea() const noexcept {
+      utils::Sizef window = LayoutItem::getRenderingArea().toSize();
+
+      return utils::Boxf(
+        0.0f,
+        0.0f,
+        std::max(0.0f, window.w() - 2.0f * getFrameDimensions()),
+        std::max(0.0f, window.h() - 2.0f * getFrameDimensions())
+      );
+    }
+
+    inline
+    void
+    ProgressBar::clearTextures() {
+      if (m_gradientTex.valid()) {
+        getEngine().destroyTexture(m_gradientTex);
+        m_gradientTex.invalidate();
+      }
+
+      if (m_emptyTex.valid()) {
+        getEngine().destroyTexture(m_emptyTex);
+        m_emptyTex.invalidate();
+      }
     }
 
   }
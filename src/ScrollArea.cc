@@ -17,9 +17,10 @@ namespace sdl {
 
       m_propsLocker(),
 
-      m_cornerName(),
-      m_hBarName(),
-      m_vBarName(),
+      m_viewport(),
+      m_corner(),
+      m_hBar(),
+      m_vBar(),
 
       m_hBarSignals(
         ScrollBarSignals{
@@ -46,8 +47,11 @@ namespace sdl {
       // Protect from concurrent accesses.
       const std::lock_guard guard(m_propsLocker);
 
+      // Forget about widgets which might have been deleted externally.
+      clearDeletedChildren();
+
       // First thing is to remove any existing corner widget.
-      core::SdlWidget* wid = getChildOrNull<core::SdlWidget>(m_cornerName);
+      core::SdlWidget* wid = m_corner.get();
 
       // If this item is not null we need to remove it.
       if (wid != nullptr) {
@@ -60,11 +64,11 @@ namespace sdl {
         // Insert the input widget as child of this widget so that it gets redrawn.
         corner->setParent(this);
 
-        // Assign the new name of the corner widget.
-        m_cornerName = corner->getName();
+        // Keep track of the new corner widget.
+        m_corner.reset(corner);
 
         // We rely on the internal layout method to perform the insertion.
-        getLayout().addItem(corner, 1, 1, 1, 1);
+        getLayout().addItem<1u, 1u>(corner);
 
         // Also we need to refresh the data for this corner widget in the virtual
         // layout so that we can still determine which elements are visible based
@@ -82,15 +86,18 @@ namespace sdl {
       // Protect from concurrent accesses.
       const std::lock_guard guard(m_propsLocker);
 
+      // Forget about widgets which might have been deleted externally.
+      clearDeletedChildren();
+
       // First thing is to remove any existing scroll bar.
-      ScrollBar* bar = getChildOrNull<ScrollBar>(m_hBarName);
+      ScrollBar* bar = m_hBar.get();
       ScrollableWidget* viewport = getViewportHandler();
 
       // If this item is not null we need to remove it.
       if (bar != nullptr) {
         // Disconnect from the signals associated to this scroll bar.
         bar->onValueChanged.disconnect(m_hBarSignals.valueChangedID);
-        viewport->onHorizontalAxisChanged.disconnect(m_hBarSignals.valueChangedID);
+        viewport->onHorizontalAxisChanged.disconnect(m_hBarSignals.axisChangedID);
 
         // Remove the item from the layout.
         removeItem(bar);
@@ -102,11 +109,11 @@ namespace sdl {
         // Insert the input widget as child of this widget so that it gets redrawn.
         scrollBar->setParent(this);
 
-        // Assign the new name of the scroll bar.
-        m_hBarName = scrollBar->getName();
+        // Keep track of the new scroll bar.
+        m_hBar.reset(scrollBar);
 
         // We rely on the internal layout method to perform the insertion.
-        getLayout().addItem(scrollBar, 0, 1, 1, 1);
+        getLayout().addItem<0u, 1u>(scrollBar);
 
         // Also we need to refresh the data for this scroll bar in the virtual
         // layout so that we can still determine which elements are visible
@@ -136,15 +143,18 @@ namespace sdl {
       // Protect from concurrent accesses.
       const std::lock_guard guard(m_propsLocker);
 
+      // Forget about widgets which might have been deleted externally.
+      clearDeletedChildren();
+
       // First thing is to remove any existing scroll bar.
-      ScrollBar* bar = getChildOrNull<ScrollBar>(m_vBarName);
+      ScrollBar* bar = m_vBar.get();
       ScrollableWidget* viewport = getViewportHandler();
 
       // If this item is not null we need to remove it.
       if (bar != nullptr) {
         // Disconnect from the signal indicating a value change.
         bar->onValueChanged.disconnect(m_vBarSignals.valueChangedID);
-        viewport->onVerticalAxisChanged.disconnect(m_vBarSignals.valueChangedID);
+        viewport->onVerticalAxisChanged.disconnect(m_vBarSignals.axisChangedID);
 
         // Remove the item from the layout.
         removeItem(bar);
@@ -157,11 +167,11 @@ namespace sdl {
         // redrawn.
         scrollBar->setParent(this);
 
-        // Assign the new name of the scroll bar.
-        m_vBarName = scrollBar->getName();
+        // Keep track of the new scroll bar.
+        m_vBar.reset(scrollBar);
 
         // We rely on the internal layout method to perform the insertion.
-        getLayout().addItem(scrollBar, 1, 0, 1, 1);
+        getLayout().addItem<1u, 0u>(scrollBar);
 
         // Also we need to refresh the data for this scroll bar in the virtual
         // layout so that we can still determine which elements are visible
@@ -245,24 +255,53 @@ namespace sdl {
       // size of the elements.
       getLayout().removeItem(widget);
 
-      if (widget->getName() == m_cornerName) {
+      if (m_corner.is(widget)) {
         m_orderData.corner->setVisible(false);
+        m_corner.reset();
       }
-      if (widget->getName() == m_hBarName) {
+      if (m_hBar.is(widget)) {
         m_orderData.hBar->setVisible(false);
+        m_hBar.reset();
       }
-      if (widget->getName() == m_vBarName) {
+      if (m_vBar.is(widget)) {
         m_orderData.vBar->setVisible(false);
+        m_vBar.reset();
       }
 
       // Now we can remove the input `widget` from the children' list.
       removeWidget(widget);
     }
 
+    void
+    ScrollArea::clearDeletedChildren() {
+      if (m_corner.valid() && !hasChild(m_corner.getName())) {
+        warn("Corner widget \"" + m_corner.getName() + "\" was deleted externally");
+        m_orderData.corner->setVisible(false);
+        m_corner.reset();
+      }
+
+      // The connection from the scroll bar has been destroyed with it but
+      // the viewport is still notifying the deleted bar.
+      if (m_hBar.valid() && !hasChild(m_hBar.getName())) {
+        warn("Horizontal scroll bar \"" + m_hBar.getName() + "\" was deleted externally");
+        getViewportHandler()->onHorizontalAxisChanged.disconnect(m_hBarSignals.axisChangedID);
+        m_orderData.hBar->setVisible(false);
+        m_hBar.reset();
+      }
+
+      if (m_vBar.valid() && !hasChild(m_vBar.getName())) {
+        warn("Vertical scroll bar \"" + m_vBar.getName() + "\" was deleted externally");
+        getViewportHandler()->onVerticalAxisChanged.disconnect(m_vBarSignals.axisChangedID);
+        m_orderData.vBar->setVisible(false);
+        m_vBar.reset();
+      }
+    }
+
     void
     ScrollArea::build() {
       // Create the layout for this widget: the general disposition makes the
-      // use of a `GridLyaout` quite natural so we'll go with this. The scroll
+      // use of a `GridLyaout` quite natural so we'll go with this. As the
+      // shape of the grid never changes we use a `FixedGridLayout`. The scroll
       // bars should be clamped in size because we don't really need them to
       // become too big.
       // Also we should allocate the needed data to hold the predicted values
@@ -271,11 +310,9 @@ namespace sdl {
       initLayoutData();
 
       // Create the layout and check for errors.
-      GridLayoutShPtr grid = std::make_shared<GridLayout>(
+      FixedGridLayoutShPtr<2u, 2u> grid = std::make_shared<ScrollGridLayout>(
         std::string("grid_layout_for_scroll_area"),
         this,
-        2u,
-        2u,
         0.0f
       );
 
@@ -325,10 +362,13 @@ namespace sdl {
         );
       }
 
+      // The viewport is needed to connect the scroll bars.
+      m_viewport.reset(viewport);
+
       // Add scroll bars and viewport to the layout.
       setHorizontalScrollBar(hBar);
       setVerticalScrollBar(vBar);
-      grid->addItem(viewport, 0, 0, 1, 1);
+      grid->addItem<0u, 0u>(viewport);
     }
 
     void
@@ -341,11 +381,9 @@ namespace sdl {
       m_orderData.corner = std::make_shared<VirtualLayoutItem>(std::string("vitem_for_corner"));
 
       // Initialize the layout.
-      m_orderData.layout = std::make_shared<GridLayout>(
+      m_orderData.layout = std::make_shared<ScrollGridLayout>(
         std::string("virtual_glayout_for_scroll_area"),
         this,
-        2u,
-        2u,
         0.0f
       );
 
@@ -356,10 +394,10 @@ namespace sdl {
         );
       }
 
-      m_orderData.layout->addItem(m_orderData.scrollable.get(), 0, 0, 1, 1);
-      m_orderData.layout->addItem(m_orderData.hBar.get(), 0, 1, 1, 1);
-      m_orderData.layout->addItem(m_orderData.vBar.get(), 1, 0, 1, 1);
-      m_orderData.layout->addItem(m_orderData.corner.get(), 1, 1, 1, 1);
+      m_orderData.layout->addItem<0u, 0u>(m_orderData.scrollable.get());
+      m_orderData.layout->addItem<0u, 1u>(m_orderData.hBar.get());
+      m_orderData.layout->addItem<1u, 0u>(m_orderData.vBar.get());
+      m_orderData.layout->addItem<1u, 1u>(m_orderData.corner.get());
 
       // The `scrollable` widget is always visible, the rest will be
       // assigned from the `build` method if needed.
@@ -390,6 +428,9 @@ namespace sdl {
       // so that the indication is correct compared to how the size of the
       // scrollable widget compares to the size of the scroll area.
 
+      // Make sure that the scroll bars still exist.
+      clearDeletedChildren();
+
       // Assign visibility statuses for scroll bars.
       float leftW, leftH;
       bool needHBar = isHSBarVisible(internal.w(), &leftW);
@@ -411,8 +452,8 @@ namespace sdl {
         sVBar = m_orderData.vBar->getRenderingArea().toSize();
       }
 
-      ScrollBar* hBar = getChildOrNull<ScrollBar>(m_hBarName);
-      ScrollBar* vBar = getChildOrNull<ScrollBar>(m_vBarName);
+      ScrollBar* hBar = m_hBar.get();
+      ScrollBar* vBar = m_vBar.get();
 
       // Update visibility status in case one of the status bar makes the
       // available space too small for the other. Typically imagine the
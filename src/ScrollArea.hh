@@ -4,7 +4,8 @@
 # include <memory>
 # include <sdl_core/SdlWidget.hh>
 # include "ScrollBar.hh"
-# include "GridLayout.hh"
+# include "ChildHandle.hh"
+# include "FixedGridLayout.hh"
 # include "ScrollableWidget.hh"
 # include "VirtualLayoutItem.hh"
 
@@ -124,6 +125,12 @@ namespace sdl {
 
       private:
 
+        /**
+         * @brief - The layout used by scroll areas: the viewport, the scroll bars and the
+         *          corner widget are always arranged in a 2x2 grid.
+         */
+        using ScrollGridLayout = FixedGridLayout<2u, 2u>;
+
         /**
          * @brief - Used to retrieve a string describing the name of the viewport.
          *          This is particularly useful to easily find this component in
@@ -223,7 +230,7 @@ namespace sdl {
          *          some reasons an error is raised.
          * @return - the layout associated to this scroll area.
          */
-        GridLayout&
+        ScrollGridLayout&
         getLayout() const;
 
         /**
@@ -245,6 +252,18 @@ namespace sdl {
         void
         removeItem(core::SdlWidget* widget);
 
+        /**
+         * @brief - Used to reset the handles referencing the corner widget and the
+         *          scroll bars when the corresponding widget is not a child of this
+         *          area anymore. These widgets are provided by the user and might be
+         *          deleted externally: this method should be called before using the
+         *          handles so that we never dereference a deleted widget.
+         *          Note that this method assumes that the locker protecting the
+         *          internal attributes from concurrent access is already locked.
+         */
+        void
+        clearDeletedChildren();
+
         /**
          * @brief - Used by the constructor to perform the creation of the needed
          *          resources for this scroll area (namely scroll bars).
@@ -279,7 +298,7 @@ namespace sdl {
          *          the size of the scrollable widget and of the bars.
          */
         struct LayoutData {
-          GridLayoutShPtr layout;
+          FixedGridLayoutShPtr<2u, 2u> layout;
           VirtualLayoutItemShPtr scrollable;
           VirtualLayoutItemShPtr hBar;
           VirtualLayoutItemShPtr vBar;
@@ -319,13 +338,15 @@ namespace sdl {
         mutable std::mutex m_propsLocker;
 
         /**
-         * @brief - Describes the name of the various widgets used to describe this
-         *          scroll area. This is used to correctly retrieve the element to
-         *          delete when assigning a new scroll bar, viewport or corner.
+         * @brief - The various widgets used to describe this scroll area. This is used
+         *          to correctly retrieve the element to delete when assigning a new
+         *          scroll bar or corner. The handles are reset when the corresponding
+         *          widget is removed from the area.
          */
-        std::string m_cornerName;
-        std::string m_hBarName;
-        std::string m_vBarName;
+        ChildHandle<ScrollableWidget> m_viewport;
+        ChildHandle<core::SdlWidget> m_corner;
+        ChildHandle<ScrollBar> m_hBar;
+        ChildHandle<ScrollBar> m_vBar;
 
         /**
          * @brief - Describes the index of the signals connected to the horizontal
@@ -136,10 +136,10 @@ namespace sdl {
     }
 
     inline
-    GridLayout&
+    ScrollArea::ScrollGridLayout&
     ScrollArea::getLayout() const {
-      // Try to retrieve the layout as a `GridLayout`.
-      GridLayout* layout = getLayoutAs<GridLayout>();
+      // Try to retrieve the layout as a `ScrollGridLayout`.
+      ScrollGridLayout* layout = getLayoutAs<ScrollGridLayout>();
 
       // If the conversion failed, this is a problem.
       if (layout == nullptr) {
@@ -156,10 +156,10 @@ namespace sdl {
     inline
     ScrollableWidget*
     ScrollArea::getViewportHandler() const {
-      // Try to retrieve the layout as a `GridLayout`.
-      ScrollableWidget* viewport = getChildAs<ScrollableWidget>(getViewportName());
+      // The viewport is resolved when building the scroll area.
+      ScrollableWidget* viewport = m_viewport.get();
 
-      // If the conversion failed, this is a problem.
+      // If it does not exist, this is a problem.
       if (viewport == nullptr) {
         error(
           std::string("Cannot retrieve viewport handler for scroll area"),
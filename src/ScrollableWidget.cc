@@ -9,7 +9,7 @@ namespace sdl {
                                        const utils::Sizef& area):
       core::SdlWidget(name, area, parent),
 
-      m_supportName(),
+      m_support(),
       m_coordsToFollow(nullptr)
     {
       // We don't want the widget to be sensitive to hover over events.
@@ -23,20 +23,21 @@ namespace sdl {
       // Protect from concurrent accesses.
       const std::lock_guard guard(m_propsLocker);
 
-      // Try to retrieve the existing support widget and remove it.
-      core::SdlWidget* sup = getChildOrNull<core::SdlWidget>(m_supportName);
-
-      if (sup != nullptr) {
-        removeWidget(sup);
+      // Try to retrieve the existing support widget and remove it. In case
+      // it has been deleted externally we only need to forget about it.
+      if (hasSupportWidget()) {
+        removeWidget(m_support.get());
       }
 
+      m_support.reset();
+
       // Now insert the input widget as a support widget for this object.
       if (widget != nullptr) {
         // Insert the input widget as child of this widget so that it gets redrawn.
         widget->setParent(this);
 
-        // Assign the new name of the scroll bar.
-        m_supportName = widget->getName();
+        // Keep track of the new support widget.
+        m_support.reset(widget);
 
         // Perform the setup of the support widget
         setupSupport(widget);
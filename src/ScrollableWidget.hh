@@ -5,6 +5,7 @@
 # include <memory>
 # include <sdl_core/SdlWidget.hh>
 # include <maths_utils/Vector2.hh>
+# include "ChildHandle.hh"
 # include "ScrollOrientation.hh"
 
 namespace sdl {
@@ -384,11 +385,11 @@ namespace sdl {
         mutable std::mutex m_propsLocker;
 
         /**
-         * @brief - Used to hold the name of the support widget currently managed
-         *          by this scrollable object. This is used when we need to delete
-         *          the corresponding data when the content is updated for example.
+         * @brief - Used to hold the support widget currently managed by this
+         *          scrollable object. This is used when we need to delete the
+         *          corresponding data when the content is updated for example.
          */
-        std::string m_supportName;
+        ChildHandle<core::SdlWidget> m_support;
 
         /**
          * @brief - Used to keep the initial position that was under the cursor when
@@ -116,14 +116,22 @@ namespace sdl {
     inline
     bool
     ScrollableWidget::hasSupportWidget() const noexcept {
-      return hasChild(m_supportName);
+      // The support widget is provided by the user and might have been deleted
+      // externally: in this case it is not a child of this widget anymore.
+      return m_support.valid() && hasChild(m_support.getName());
     }
 
     inline
     core::SdlWidget*
     ScrollableWidget::getSupportWidget() const {
-      // Use the base handler to retrieve the support widget if any.
-      return getChildAs<core::SdlWidget>(m_supportName);
+      if (!hasSupportWidget()) {
+        error(
+          std::string("Cannot retrieve support widget for scrollable widget"),
+          std::string("No support widget assigned")
+        );
+      }
+
+      return m_support.get();
     }
 
     inline
@@ -10,7 +10,8 @@ namespace sdl {
                                    float margin):
       core::Layout(name, widget, margin),
       m_activeItem(-1),
-      m_idsToPosition()
+      m_idsToPosition(),
+      m_pagesLaidOut(false)
     {
       // Nothing to do.
     }
@@ -33,9 +34,17 @@ namespace sdl {
         return m_activeItem;
       }
 
-      // Activate the input item and invalidate the layout.
+      // Activate the input item. In case all the pages are already laid
+      // out for the current window we only need to display the new one:
+      // otherwise we need to invalidate the layout.
       m_activeItem = index;
-      makeGeometryDirty();
+
+      if (m_pagesLaidOut) {
+        showActiveItem();
+      }
+      else {
+        makeGeometryDirty();
+      }
 
       return m_activeItem;
     }
@@ -66,42 +75,75 @@ namespace sdl {
 
       // Retrieve the realID of the desired active item from the
       // internal array.
-      const int realID = m_idsToPosition[m_activeItem];
+      const int realID = m_idsToPosition.getPhysicalID(m_activeItem);
 
       // Disable other items.
-      std::vector<bool> visible(getItemsCount(), false);
-      visible[realID] = true;
-      assignVisibilityStatus(visible);
+      showActiveItem();
+
+      LAYOUT_STATS(m_stats.start());
 
-      // Compute the available space for the active child.
+      // Compute the available space for the children.
       const utils::Sizef componentSize = computeAvailableSize(window);
 
       // Compute item's properties.
       std::vector<WidgetInfo> itemsInfo = computeItemsInfo();
 
-      // Assign the space for the active child: as this is the only
-      // child, use all the available space.
+      LAYOUT_STATS(m_stats.phase(layout::Phase::ItemsInfo));
+
+      // Each page can use all the available space. We lay out all
+      // of them and not only the active one: this way the hidden
+      // pages already have their final size and switching to one
+      // of them only requires to change the visibility status. It
+      // also allows them to keep their textures when they are not
+      // displayed instead of being resized to an empty area.
+      // Note that the textures of a page are only created when it
+      // is drawn and only visible items are drawn: we can't prewarm
+      // a page which was never displayed so its first activation
+      // still pays for the creation of its textures.
       std::vector<utils::Boxf> bboxes(getItemsCount(), utils::Boxf());
 
-      // Assign the maximum size for this item based on its internal
-      // size policy. We also account for the offset to apply in case
-      // the size does not occupy fully the available space.
-      utils::Sizef area = computeSizeFromPolicy(bboxes[realID], componentSize, itemsInfo[realID]);
+      for (int id = 0 ; id < getItemsCount() ; ++id) {
+        // Assign the maximum size for this item based on its internal
+        // size policy. We also account for the offset to apply in case
+        // the size does not occupy fully the available space.
+        utils::Sizef area = computeSizeFromPolicy(bboxes[id], componentSize, itemsInfo[id]);
+
+        // Only report problems for the item which is displayed.
+        if (id == realID && !area.compareWithTolerance(componentSize, 0.5f)) {
+          warn(
+            std::string("Could only achieve size of ") + area.toString() +
+            " but available space is " + componentSize.toString()
+          );
+        }
 
-      if (!area.compareWithTolerance(componentSize, 0.5f)) {
-        warn(
-          std::string("Could only achieve size of ") + area.toString() +
-          " but available space is " + componentSize.toString()
-        );
-      }
+        const float x = getMargin().w() + (componentSize.w() - area.w()) / 2.0f;
+        const float y = getMargin().h() + (componentSize.h() - area.h()) / 2.0f;
 
-      const float x = getMargin().w() + (componentSize.w() - area.w()) / 2.0f;
-      const float y = getMargin().h() + (componentSize.h() - area.h()) / 2.0f;
+        bboxes[id] = utils::Boxf(x, y, area);
 
-      bboxes[realID] = utils::Boxf(x, y, area);
+        LAYOUT_STATS(m_stats.clamp(area, itemsInfo[id].min, itemsInfo[id].max));
+      }
 
       // Use the base handler to assign bbox.
       assignRenderingAreas(bboxes, window);
+
+      LAYOUT_STATS(m_stats.phase(layout::Phase::Positioning));
+
+      // Until the next item is inserted or removed, activating any
+      // item does not require to compute the geometry again.
+      m_pagesLaidOut = true;
+    }
+
+    void
+    SelectorLayout::showActiveItem() {
+      // Only the active item is visible.
+      std::vector<bool> visible(getItemsCount(), false);
+
+      if (m_activeItem >= 0) {
+        visible[m_idsToPosition.getPhysicalID(m_activeItem)] = true;
+      }
+
+      assignVisibilityStatus(visible);
     }
 
     bool
@@ -111,24 +153,9 @@ namespace sdl {
       debug("Removing item " + std::to_string(logicID) + " from selector layout");
 
       // Now update the local information by removing the input item from the internal
-      // table. We basically copy all the information except for the deleted item.
-      // Note that the internal `m_idsToPosition` will be left unchanged for values
-      // smaller than `rmLogicID` and shifted by one for value larger than that.
-      IdToPosition newIDs(m_idsToPosition.size() - 1);
-      for (int id = 0 ; id < static_cast<int>(m_idsToPosition.size()) ; ++id) {
-        if (id < logicID) {
-          newIDs[id] = m_idsToPosition[id];
-        }
-        else if (id == logicID) {
-          // Ignore this item as it will be deleted.
-        }
-        else {
-          newIDs[id - 1] = m_idsToPosition[id];
-        }
-      }
-
-      // Swap with the internal array.
-      m_idsToPosition.swap(newIDs);
+      // table. Note that the internal `m_idsToPosition` will be left unchanged for
+      // values smaller than `logicID` and shifted by one for value larger than that.
+      m_idsToPosition.erase(logicID);
 
       // Now we need to handle the active item. Note that we do not rely on the
       // input real ID `item` but rather on the corresponding logical id fetched
@@ -194,29 +221,14 @@ namespace sdl {
       // We now need to update the internal `m_idsToPosition` array. This array
       // contains for each logical id the real position of the item. Of course
       // the insertion of the item `logicalID` might disrupt the existing values
-      // so we need to account for that.
-      // To do so we need to traverse the existing internal array and update each
+      // so we need to account for that: the associations table relabels each
       // logical id greater than the input `logicalID`.
 
       // Update logical ids.
-      IdToPosition newIDs(m_idsToPosition.size() + 1);
-      for (int id = 0 ; id < static_cast<int>(m_idsToPosition.size()) ; ++id) {
-        if (id < logicID) {
-          // The item is before the `logicalID` in order: keep it at the same spot.
-          newIDs[id] = m_idsToPosition[id];
-        }
-        else {
-          // This item is after the newly inserted `logicalID`: move it back in the
-          // list.
-          newIDs[id + 1] = m_idsToPosition[id];
-        }
-      }
-
-      // Assign the new `logicID`.
-      newIDs[logicID] = realID;
+      m_idsToPosition.insert(logicID, realID);
 
-      // Swap with the internal array.
-      m_idsToPosition.swap(newIDs);
+      // The new item does not have a size yet.
+      m_pagesLaidOut = false;
 
       // Now we need to handle automatic activation of the first item when it is
       // inserted.
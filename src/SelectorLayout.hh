@@ -3,6 +3,8 @@
 
 # include <memory>
 # include <sdl_core/Layout.hh>
+# include "IdsMapping.hh"
+# include "LayoutStats.hh"
 
 namespace sdl {
   namespace graphic {
@@ -26,6 +28,16 @@ namespace sdl {
         int
         setActiveItem(const std::string& name);
 
+        /**
+         * @brief - Used to activate the item at `index`. All the items of this layout
+         *          are laid out for the current window so if no item was inserted or
+         *          removed since the last geometry computation, this only changes the
+         *          visibility of the items.
+         *          Note that pages are not prewarmed: the first activation of a
+         *          page still creates its textures as it was never drawn before.
+         * @param index - the index of the item to activate.
+         * @return - the current active item.
+         */
         int
         setActiveItem(int index);
 
@@ -45,6 +57,24 @@ namespace sdl {
         int
         getActiveItemId() const;
 
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Retrieves the statistics recorded during the last geometry
+         *          computation of this layout.
+         * @return - the statistics of this layout.
+         */
+        const layout::Stats&
+        getStats() const noexcept;
+
+        /**
+         * @brief - Dumps the phases recorded since the last dump in the Chrome trace
+         *          event format. Raises an error if the file cannot be written.
+         * @param file - the path to the output file.
+         */
+        void
+        dumpStatsTrace(const std::string& file);
+# endif
+
       protected:
 
         void
@@ -52,9 +82,8 @@ namespace sdl {
 
         /**
          * @brief - Reimplementation of the base `Layout` method in order to associate
-         *          the logical id to the physical id. This method basically traverses
-         *          the internal array of associations and try to find the corresponding
-         *          id.
+         *          the logical id to the physical id using the internal table of
+         *          associations.
          * @param physID - the physical id for which the logical id should be returned.
          * @return - an logical index which corresponds to the input physical id or a
          *           negative value if no such index exists in the layout.
@@ -106,9 +135,14 @@ namespace sdl {
                             int logicalID,
                             int realID);
 
-      private:
+        /**
+         * @brief - Used to make the active item visible and hide all the others. No
+         *          geometry is computed so the items keep their current size.
+         */
+        void
+        showActiveItem();
 
-        using IdToPosition = std::vector<int>;
+      private:
 
         int m_activeItem;
 
@@ -116,8 +150,24 @@ namespace sdl {
          * @brief - Allows to store the logical position of the item stored at a given
          *          position in the parent table. This allows to correctly assign the
          *          rendering area to widgets based on their index in the layout.
+         *          Both directions of the association are indexed so that lookups
+         *          do not need to traverse the table.
+         */
+        IdsMapping m_idsToPosition;
+
+        /**
+         * @brief - Indicates whether all the items of this layout have been assigned
+         *          an area by the last geometry computation. In this case switching
+         *          the active item only changes the visibility of the items.
+         */
+        bool m_pagesLaidOut;
+
+# ifdef SDL_GRAPHIC_LAYOUT_STATS
+        /**
+         * @brief - Records the statistics of the geometry computations.
          */
-        IdToPosition m_idsToPosition;
+        mutable LayoutStatsRecorder m_stats;
+# endif
     };
 
     using SelectorLayoutShPtr = std::shared_ptr<SelectorLayout>;
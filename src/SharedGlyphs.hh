@@ -0,0 +1,237 @@
+#ifndef    SHARED_GLYPHS_HH
+# define   SHARED_GLYPHS_HH
+
+# include <mutex>
+# include <memory>
+# include <string>
+# include <string_view>
+# include <unordered_map>
+# include <core_utils/Uuid.hh>
+# include <maths_utils/Box.hh>
+# include <maths_utils/Size.hh>
+# include <sdl_engine/Engine.hh>
+# include <sdl_engine/Palette.hh>
+# include "GlyphCache.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Registry of the glyph caches which can be shared by several widgets. Each
+     *          cache is identified by a key describing the font used to render its glyphs
+     *          (its name, its size and the colors of the roles used for texts) so that the
+     *          widgets displaying text with the same font only render each glyph once.
+     *          Caches are reference counted: the registry creates them on the first call
+     *          to `acquire` and the glyphs are destroyed on the final `release`.
+     *          As the identifiers of textures are only meaningful for the engine which
+     *          created them, the registry keeps distinct caches for each engine.
+     */
+    class SharedGlyphs {
+      public:
+
+        using Role = GlyphCache::Role;
+
+        /**
+         * @brief - A glyph cache shared by several widgets. Accesses to the glyphs are
+         *          protected by a lock as the widgets may be used from distinct threads.
+         *          Missing glyphs are rendered with the font provided by the widget which
+         *          needs them: as all the fonts sharing a cache are identical, the glyph
+         *          does not depend on which widget rendered it.
+         *          Note that the lock is held while calling into the engine to render or
+         *          draw the glyphs.
+         */
+        class Cache {
+          public:
+
+            Cache();
+
+            ~Cache() = default;
+
+            /**
+             * @brief - Used to render the glyphs of all the code points of the input text
+             *          which are not yet available.
+             * @param text - the text containing the code points to load.
+             * @param role - the color role of the glyphs.
+             * @param engine - the engine to use to render missing glyphs.
+             * @param font - the font to use to render missing glyphs, assumed to be valid.
+             */
+            void
+            preload(std::string_view text,
+                    const Role& role,
+                    core::engine::Engine& engine,
+                    const utils::Uuid& font);
+
+            /**
+             * @brief - Computes the size of the input text when drawn with the glyphs of
+             *          this cache. Missing glyphs are rendered on the fly.
+             * @param text - the text to measure.
+             * @param role - the color role of the glyphs.
+             * @param engine - the engine to use to render missing glyphs.
+             * @param font - the font to use to render missing glyphs, assumed to be valid.
+             * @return - the size of the text.
+             */
+            utils::Sizef
+            measure(std::string_view text,
+                    const Role& role,
+                    core::engine::Engine& engine,
+                    const utils::Uuid& font);
+
+            /**
+             * @brief - Lays out the input text in the `dst` area and calls the `painter` for
+             *          each glyph along with the area it covers. See `GlyphCache::draw` for
+             *          more details.
+             * @param text - the text to draw.
+             * @param role - the color role of the glyphs.
+             * @param dst - the area covered by the whole text.
+             * @param engine - the engine to use to render missing glyphs.
+             * @param font - the font to use to render missing glyphs, assumed to be valid.
+             * @param painter - a callable `void(const GlyphCache::Glyph&, const utils::Boxf&)`
+             *                  which draws a glyph at the specified position.
+             */
+            template <typename Painter>
+            void
+            draw(std::string_view text,
+                 const Role& role,
+                 const utils::Boxf& dst,
+                 core::engine::Engine& engine,
+                 const utils::Uuid& font,
+                 Painter&& painter);
+
+            /**
+             * @brief - Used to retrieve the statistics of the cache. Note that they account
+             *          for the operations performed by all the widgets sharing this cache.
+             * @return - the statistics of the cache.
+             */
+            GlyphCache::Stats
+            getStats();
+
+          private:
+
+            friend class SharedGlyphs;
+
+            /**
+             * @brief - Protects the glyphs from concurrent accesses.
+             */
+            std::mutex m_locker;
+
+            /**
+             * @brief - The glyphs rendered so far.
+             */
+            GlyphCache m_glyphs;
+        };
+
+        using CacheShPtr = std::shared_ptr<Cache>;
+
+        /**
+         * @brief - Retrieves the registry shared by the application.
+         * @return - the shared glyphs' registry.
+         */
+        static
+        SharedGlyphs&
+        getInstance();
+
+        ~SharedGlyphs() = default;
+
+        /**
+         * @brief - Retrieves the cache associated to the input key for the engine, creating
+         *          it if it does not exist yet. Each call should be matched by a call to
+         *          `release` with the same engine and key.
+         * @param engine - the engine which renders the glyphs.
+         * @param key - the key describing the font of the glyphs as returned by the
+         *              `keyFromFont` method.
+         * @return - the shared cache.
+         */
+        CacheShPtr
+        acquire(const core::engine::Engine& engine,
+                const std::string& key);
+
+        /**
+         * @brief - Indicates that a user of the cache associated to the key for the engine
+         *          does not need it anymore. In case this was the last user, the textures
+         *          of the glyphs are destroyed through the `engine`. Nothing happens if the
+         *          cache is not set.
+         * @param engine - the engine which rendered the glyphs.
+         * @param cache - the cache to release, reset by this method.
+         * @param key - the key of the cache, cleared by this method.
+         */
+        void
+        release(core::engine::Engine& engine,
+                CacheShPtr& cache,
+                std::string& key);
+
+        /**
+         * @brief - Retrieves the number of caches currently shared, for all engines.
+         * @return - the number of caches registered.
+         */
+        std::size_t
+        size();
+
+        /**
+         * @brief - Used to describe the font used to render glyphs. As fonts are colored
+         *          with the palette of the widget which creates them, the key includes the
+         *          colors of the roles used to render texts (`WindowText` for the regular
+         *          text and `HighlightedText` for text displayed on a highlighted area).
+         * @param name - the name of the font.
+         * @param size - the size of the font.
+         * @param palette - the palette used to create the font.
+         * @return - a key uniquely identifying the glyphs rendered with the font.
+         */
+        static
+        std::string
+        keyFromFont(const std::string& name,
+                    unsigned size,
+                    const core::engine::Palette& palette);
+
+        /**
+         * @brief - Used to render the glyph representing a single code point with the
+         *          specified role. This is the loader used by the caches to create the
+         *          glyphs which are not available yet.
+         * @param engine - the engine to use to render the glyph.
+         * @param font - the font to use to render the glyph, assumed to be valid.
+         * @param character - the UTF-8 sequence of the code point to render.
+         * @param role - the color role of the glyph.
+         * @return - the glyph representing the code point.
+         */
+        static
+        GlyphCache::Glyph
+        loadGlyph(core::engine::Engine& engine,
+                  const utils::Uuid& font,
+                  std::string_view character,
+                  const Role& role);
+
+      private:
+
+        SharedGlyphs();
+
+      private:
+
+        /**
+         * @brief - A shared cache along with the number of widgets using it.
+         */
+        struct Entry {
+          CacheShPtr cache;
+          unsigned users;
+        };
+
+        using Caches = std::unordered_map<std::string, Entry>;
+        using Registries = std::unordered_map<const core::engine::Engine*, Caches>;
+
+        /**
+         * @brief - Protects the registry from concurrent accesses. It is never held while
+         *          calling into an engine.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The caches shared so far indexed by the engine which renders their
+         *          glyphs and by their key.
+         */
+        Registries m_registries;
+    };
+
+  }
+}
+
+# include "SharedGlyphs.hxx"
+
+#endif    /* SHARED_GLYPHS_HH */
@@ -0,0 +1,217 @@
+#ifndef    SHARED_GLYPHS_HXX
+# define   SHARED_GLYPHS_HXX
+
+# include "SharedGlyphs.hh"
+# include "SharedTextures.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    SharedGlyphs::Cache::Cache():
+      m_locker(),
+
+      m_glyphs()
+    {
+      // Nothing to do.
+    }
+
+    inline
+    void
+    SharedGlyphs::Cache::preload(std::string_view text,
+                                 const Role& role,
+                                 core::engine::Engine& engine,
+                                 const utils::Uuid& font)
+    {
+      const std::lock_guard guard(m_locker);
+
+      m_glyphs.preload(
+        text,
+        role,
+        [&engine, &font](std::string_view c, const Role& r) {
+          return loadGlyph(engine, font, c, r);
+        }
+      );
+    }
+
+    inline
+    utils::Sizef
+    SharedGlyphs::Cache::measure(std::string_view text,
+                                 const Role& role,
+                                 core::engine::Engine& engine,
+                                 const utils::Uuid& font)
+    {
+      const std::lock_guard guard(m_locker);
+
+      return m_glyphs.measure(
+        text,
+        role,
+        [&engine, &font](std::string_view c, const Role& r) {
+          return loadGlyph(engine, font, c, r);
+        }
+      );
+    }
+
+    template <typename Painter>
+    inline
+    void
+    SharedGlyphs::Cache::draw(std::string_view text,
+                              const Role& role,
+                              const utils::Boxf& dst,
+                              core::engine::Engine& engine,
+                              const utils::Uuid& font,
+                              Painter&& painter)
+    {
+      const std::lock_guard guard(m_locker);
+
+      m_glyphs.draw(
+        text,
+        role,
+        dst,
+        [&engine, &font](std::string_view c, const Role& r) {
+          return loadGlyph(engine, font, c, r);
+        },
+        painter
+      );
+    }
+
+    inline
+    GlyphCache::Stats
+    SharedGlyphs::Cache::getStats() {
+      const std::lock_guard guard(m_locker);
+      return m_glyphs.getStats();
+    }
+
+    inline
+    SharedGlyphs::SharedGlyphs():
+      m_locker(),
+
+      m_registries()
+    {
+      // Nothing to do.
+    }
+
+    inline
+    SharedGlyphs&
+    SharedGlyphs::getInstance() {
+      static SharedGlyphs glyphs;
+      return glyphs;
+    }
+
+    inline
+    SharedGlyphs::CacheShPtr
+    SharedGlyphs::acquire(const core::engine::Engine& engine,
+                          const std::string& key)
+    {
+      const std::lock_guard guard(m_locker);
+
+      Entry& entry = m_registries[&engine][key];
+
+      if (entry.cache == nullptr) {
+        entry.cache = std::make_shared<Cache>();
+        entry.users = 0u;
+      }
+
+      ++entry.users;
+
+      return entry.cache;
+    }
+
+    inline
+    void
+    SharedGlyphs::release(core::engine::Engine& engine,
+                          CacheShPtr& cache,
+                          std::string& key)
+    {
+      if (cache == nullptr) {
+        return;
+      }
+
+      CacheShPtr unused;
+      {
+        const std::lock_guard guard(m_locker);
+
+        Registries::iterator registry = m_registries.find(&engine);
+        if (registry != m_registries.end()) {
+          Caches::iterator it = registry->second.find(key);
+
+          if (it != registry->second.end()) {
+            --it->second.users;
+
+            if (it->second.users == 0u) {
+              unused = it->second.cache;
+              registry->second.erase(it);
+            }
+          }
+
+          if (registry->second.empty()) {
+            m_registries.erase(registry);
+          }
+        }
+      }
+
+      // Destroy the glyphs without holding the lock of the registry so that
+      // the engine is not called while the registry is locked.
+      if (unused != nullptr) {
+        const std::lock_guard guard(unused->m_locker);
+
+        unused->m_glyphs.clear(
+          [&engine](const utils::Uuid& texture) {
+            engine.destroyTexture(texture);
+          }
+        );
+      }
+
+      cache.reset();
+      key.clear();
+    }
+
+    inline
+    std::size_t
+    SharedGlyphs::size() {
+      const std::lock_guard guard(m_locker);
+
+      std::size_t count = 0u;
+      for (Registries::const_iterator it = m_registries.cbegin() ; it != m_registries.cend() ; ++it) {
+        count += it->second.size();
+      }
+
+      return count;
+    }
+
+    inline
+    std::string
+    SharedGlyphs::keyFromFont(const std::string& name,
+                              unsigned size,
+                              const core::engine::Palette& palette)
+    {
+      return
+        std::string("font_") + name + "_" + std::to_string(size) + "_" +
+        SharedTextures::keyFromColor(palette.getColorForRole(core::engine::Palette::ColorRole::WindowText)) + "_" +
+        SharedTextures::keyFromColor(palette.getColorForRole(core::engine::Palette::ColorRole::HighlightedText))
+      ;
+    }
+
+    inline
+    GlyphCache::Glyph
+    SharedGlyphs::loadGlyph(core::engine::Engine& engine,
+                            const utils::Uuid& font,
+                            std::string_view character,
+                            const Role& role)
+    {
+      GlyphCache::Glyph glyph{
+        engine.createTextureFromText(std::string(character), font, role),
+        utils::Sizef()
+      };
+
+      if (glyph.texture.valid()) {
+        glyph.size = engine.queryTexture(glyph.texture);
+      }
+
+      return glyph;
+    }
+
+  }
+}
+
+#endif    /* SHARED_GLYPHS_HXX */
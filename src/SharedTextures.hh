@@ -0,0 +1,170 @@
+#ifndef    SHARED_TEXTURES_HH
+# define   SHARED_TEXTURES_HH
+
+# include <mutex>
+# include <string>
+# include <functional>
+# include <unordered_map>
+# include <core_utils/Uuid.hh>
+# include <maths_utils/Size.hh>
+# include <sdl_engine/Brush.hh>
+# include <sdl_engine/Color.hh>
+# include <sdl_engine/Engine.hh>
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Registry of the textures which can be shared by several widgets. Each
+     *          texture is identified by a key describing everything that is needed to
+     *          render it (typically its colors and its size) so that widgets needing
+     *          the same visual only create it once.
+     *          Textures are reference counted: the registry creates them on the first
+     *          `acquire` and hands them back to the last user on the final `release`
+     *          so that it can destroy them through its engine.
+     *          As the identifiers of textures are only meaningful for the engine which
+     *          created them, the registry keeps distinct textures for each engine.
+     */
+    class SharedTextures {
+      public:
+
+        /**
+         * @brief - Callback used to create a texture which is not registered yet.
+         */
+        using Loader = std::function<utils::Uuid()>;
+
+        /**
+         * @brief - Retrieves the registry shared by the application.
+         * @return - the shared textures' registry.
+         */
+        static
+        SharedTextures&
+        getInstance();
+
+        ~SharedTextures() = default;
+
+        /**
+         * @brief - Retrieves the texture associated to the input key for the engine,
+         *          creating it with the `loader` if it does not exist yet. Each call
+         *          should be matched by a call to `release` with the same engine and
+         *          key.
+         * @param engine - the engine which should own the texture.
+         * @param key - the key describing the texture.
+         * @param loader - used to create the texture with the `engine` if needed. It is
+         *                 called without the lock of the registry held: in case another
+         *                 element registers the same texture in the meantime the created
+         *                 texture is destroyed and the registered one is returned.
+         * @return - the identifier of the shared texture, which is invalid if it could
+         *           not be created.
+         */
+        utils::Uuid
+        acquire(core::engine::Engine& engine,
+                const std::string& key,
+                const Loader& loader);
+
+        /**
+         * @brief - Indicates that a user of the texture associated to the key for the
+         *          engine does not need it anymore.
+         * @param engine - the engine owning the texture.
+         * @param key - the key describing the texture.
+         * @return - the identifier of the texture if this was the last user, in which
+         *           case the caller is responsible for destroying it, and an invalid
+         *           identifier otherwise.
+         */
+        utils::Uuid
+        release(const core::engine::Engine& engine,
+                const std::string& key);
+
+        /**
+         * @brief - Similar to `acquire` but creates the texture from a brush cleared with
+         *          the specified color if needed.
+         * @param engine - the engine which should own the texture.
+         * @param key - the key of the texture as returned by `keyFromBrush`.
+         * @param color - the color of the brush.
+         * @param size - the size of the brush.
+         * @return - the identifier of the shared texture, which is invalid if it could
+         *           not be created.
+         */
+        utils::Uuid
+        acquireBrush(core::engine::Engine& engine,
+                     const std::string& key,
+                     const core::engine::Color& color,
+                     const utils::Sizef& size);
+
+        /**
+         * @brief - Similar to `release` but destroys the texture through the `engine` if
+         *          no other element uses it. Nothing happens if the texture is not valid.
+         * @param engine - the engine owning the texture.
+         * @param texture - the texture to release, invalidated by this method.
+         * @param key - the key of the shared texture, cleared by this method.
+         */
+        void
+        releaseTexture(core::engine::Engine& engine,
+                       utils::Uuid& texture,
+                       std::string& key);
+
+        /**
+         * @brief - Retrieves the number of textures currently shared, for all engines.
+         * @return - the number of textures registered.
+         */
+        std::size_t
+        size();
+
+        /**
+         * @brief - Used to describe a color as part of a key.
+         * @param color - the color to describe.
+         * @return - a string uniquely identifying the color.
+         */
+        static
+        std::string
+        keyFromColor(const core::engine::Color& color);
+
+        /**
+         * @brief - Used to describe the texture produced by a brush cleared with a
+         *          single color. Such textures only depend on their color and size.
+         * @param color - the clear color of the brush.
+         * @param size - the size of the brush.
+         * @return - a key uniquely identifying the texture produced by the brush.
+         */
+        static
+        std::string
+        keyFromBrush(const core::engine::Color& color,
+                     const utils::Sizef& size);
+
+      private:
+
+        SharedTextures();
+
+      private:
+
+        /**
+         * @brief - A shared texture along with the number of elements using it.
+         */
+        struct Entry {
+          utils::Uuid texture;
+          unsigned users;
+        };
+
+        using Textures = std::unordered_map<std::string, Entry>;
+        using Registries = std::unordered_map<const core::engine::Engine*, Textures>;
+
+        /**
+         * @brief - Protects the textures from concurrent accesses: widgets from distinct
+         *          threads may share textures. It is never held while calling into an
+         *          engine.
+         */
+        std::mutex m_locker;
+
+        /**
+         * @brief - The textures shared so far indexed by the engine which created them
+         *          and by their key.
+         */
+        Registries m_registries;
+    };
+
+  }
+}
+
+# include "SharedTextures.hxx"
+
+#endif    /* SHARED_TEXTURES_HH */
@@ -0,0 +1,188 @@
+#ifndef    SHARED_TEXTURES_HXX
+# define   SHARED_TEXTURES_HXX
+
+# include "SharedTextures.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    SharedTextures::SharedTextures():
+      m_locker(),
+
+      m_registries()
+    {
+      // Nothing to do.
+    }
+
+    inline
+    SharedTextures&
+    SharedTextures::getInstance() {
+      static SharedTextures textures;
+      return textures;
+    }
+
+    inline
+    utils::Uuid
+    SharedTextures::acquire(core::engine::Engine& engine,
+                            const std::string& key,
+                            const Loader& loader)
+    {
+      {
+        const std::lock_guard guard(m_locker);
+
+        Textures& textures = m_registries[&engine];
+
+        Textures::iterator it = textures.find(key);
+        if (it != textures.end()) {
+          ++it->second.users;
+          return it->second.texture;
+        }
+      }
+
+      // Create the texture without holding the lock so that the engine is
+      // not called while the registry is locked.
+      utils::Uuid texture = loader();
+
+      // Do not register textures which could not be created: the next user
+      // will try again.
+      if (!texture.valid()) {
+        return texture;
+      }
+
+      utils::Uuid registered;
+      {
+        const std::lock_guard guard(m_locker);
+
+        Textures& textures = m_registries[&engine];
+
+        Textures::iterator it = textures.find(key);
+        if (it == textures.end()) {
+          textures[key] = Entry{texture, 1u};
+          return texture;
+        }
+
+        ++it->second.users;
+        registered = it->second.texture;
+      }
+
+      // Another element created the same texture in the meantime: keep the
+      // registered one.
+      engine.destroyTexture(texture);
+
+      return registered;
+    }
+
+    inline
+    utils::Uuid
+    SharedTextures::release(const core::engine::Engine& engine,
+                            const std::string& key)
+    {
+      const std::lock_guard guard(m_locker);
+
+      Registries::iterator registry = m_registries.find(&engine);
+      if (registry == m_registries.end()) {
+        return utils::Uuid();
+      }
+
+      Textures::iterator it = registry->second.find(key);
+      if (it == registry->second.end()) {
+        return utils::Uuid();
+      }
+
+      --it->second.users;
+      if (it->second.users > 0u) {
+        return utils::Uuid();
+      }
+
+      utils::Uuid texture = it->second.texture;
+      registry->second.erase(it);
+
+      if (registry->second.empty()) {
+        m_registries.erase(registry);
+      }
+
+      return texture;
+    }
+
+    inline
+    utils::Uuid
+    SharedTextures::acquireBrush(core::engine::Engine& engine,
+                                 const std::string& key,
+                                 const core::engine::Color& color,
+                                 const utils::Sizef& size)
+    {
+      return acquire(
+        engine,
+        key,
+        [&engine, &key, &color, &size]() {
+          core::engine::BrushShPtr brush = std::make_shared<core::engine::Brush>(
+            std::string("brush_for_") + key,
+            false
+          );
+          brush->setClearColor(color);
+          brush->create(size, true);
+
+          return engine.createTextureFromBrush(brush);
+        }
+      );
+    }
+
+    inline
+    void
+    SharedTextures::releaseTexture(core::engine::Engine& engine,
+                                   utils::Uuid& texture,
+                                   std::string& key)
+    {
+      if (!texture.valid()) {
+        return;
+      }
+
+      utils::Uuid unused = release(engine, key);
+      if (unused.valid()) {
+        engine.destroyTexture(unused);
+      }
+
+      texture.invalidate();
+      key.clear();
+    }
+
+    inline
+    std::size_t
+    SharedTextures::size() {
+      const std::lock_guard guard(m_locker);
+
+      std::size_t count = 0u;
+      for (Registries::const_iterator it = m_registries.cbegin() ; it != m_registries.cend() ; ++it) {
+        count += it->second.size();
+      }
+
+      return count;
+    }
+
+    inline
+    std::string
+    SharedTextures::keyFromColor(const core::engine::Color& color) {
+      return
+        std::to_string(color.r()) + "_" +
+        std::to_string(color.g()) + "_" +
+        std::to_string(color.b()) + "_" +
+        std::to_string(color.a())
+      ;
+    }
+
+    inline
+    std::string
+    SharedTextures::keyFromBrush(const core::engine::Color& color,
+                                 const utils::Sizef& size)
+    {
+      return
+        std::string("brush_") + keyFromColor(color) + "_" +
+        std::to_string(size.w()) + "x" + std::to_string(size.h())
+      ;
+    }
+
+  }
+}
+
+#endif    /* SHARED_TEXTURES_HXX */
@@ -33,9 +33,13 @@ namespace sdl {
       m_decimals(decimals),
 
       m_sliderChanged(true),
+      m_labelChanged(false),
+      m_valueLabel(),
       m_sliderItem(nullptr),
       m_rulerLine(),
+      m_rulerLineKey(),
       m_mobileArea(),
+      m_mobileAreaKey(),
 
       onValueChanged()
     {
@@ -67,6 +71,15 @@ namespace sdl {
         m_sliderChanged = false;
       }
 
+      // Update the label displaying the value if needed.
+      if (m_labelChanged) {
+        if (m_valueLabel.valid()) {
+          m_valueLabel->setText(stringifyValue(getValueFromRangeData(m_data), m_decimals));
+        }
+
+        m_labelChanged = false;
+      }
+
       // Repaint mobile parts to their specified position. We need to
       // only consider the input `area` to be repainted: if the visuals
       // do not intersect with it we don't need to repaint it.
@@ -330,16 +343,19 @@ namespace sdl {
       );
       label->setPalette(getPalette());
 
+      // Values are only composed of these characters: rendering them in
+      // advance means that moving the slider never creates new textures.
+      label->preloadGlyphs("0123456789-.e+");
+
       // Build up the layout with the slider's box and the value label.
       layout->addItem(m_sliderItem.get());
       layout->addItem(label);
+
+      m_valueLabel.reset(label);
     }
 
     void
     Slider::loadSlider() {
-      // Clear existing slider's elements.
-      clearSlider();
-
       // We want to create both the ruler line and the mobile area
       // to represent the slider. Note that the internal layout
       // item can be used to fetch the desired size of each one.
@@ -354,39 +370,30 @@ namespace sdl {
 
 
       // Create colors that contrast with the background.
-      core::engine::Color c = getPalette().getBackgroundColor();
       core::engine::Color rlc = getPalette().getLightColor();
       core::engine::Color mac = getPalette().getDarkColor();
 
-      // Create the ruler line
-      core::engine::BrushShPtr bRulerLine = std::make_shared<core::engine::Brush>(
-        std::string("rl_brush_for_") + getName(),
-        false
-      );
-      bRulerLine->setClearColor(rlc);
-      bRulerLine->create(
-        utils::Sizef(elemsSz.w(), getRulerLineHeight()),
-        true
-      );
-
-      m_rulerLine = getEngine().createTextureFromBrush(bRulerLine);
-
-      // Create the mobile area.
-      core::engine::BrushShPtr bMobileArea = std::make_shared<core::engine::Brush>(
-        std::string("ma_brush_for_") + getName(),
-        false
-      );
+      // Both elements only depend on their size and colors: they are
+      // shared with any other slider using the same ones. The new ones
+      // are acquired before releasing the existing ones so that they
+      // are not destroyed if they did not change.
+      utils::Sizef rlSize(elemsSz.w(), getRulerLineHeight());
 
       m_data.maBox.w() = getMobileAreaWidth();
       m_data.maBox.h() = elemsSz.h();
 
-      bMobileArea->setClearColor(mac);
-      bMobileArea->create(
-        m_data.maBox.toSize(),
-        true
-      );
+      const std::string rlKey = SharedTextures::keyFromBrush(rlc, rlSize);
+      const std::string maKey = SharedTextures::keyFromBrush(mac, m_data.maBox.toSize());
+
+      utils::Uuid rulerLine = SharedTextures::getInstance().acquireBrush(getEngine(), rlKey, rlc, rlSize);
+      utils::Uuid mobileArea = SharedTextures::getInstance().acquireBrush(getEngine(), maKey, mac, m_data.maBox.toSize());
+
+      clearSlider();
 
-      m_mobileArea = getEngine().createTextureFromBrush(bMobileArea);
+      m_rulerLine = rulerLine;
+      m_rulerLineKey = rlKey;
+      m_mobileArea = mobileArea;
+      m_mobileAreaKey = maKey;
 
       if (!m_rulerLine.valid()) {
         error(
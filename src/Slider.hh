@@ -5,6 +5,7 @@
 # include <sdl_core/SdlWidget.hh>
 # include "VirtualLayoutItem.hh"
 # include "LabelWidget.hh"
+# include "ChildHandle.hh"
 # include <core_utils/Signal.hh>
 
 namespace sdl {
@@ -301,8 +302,8 @@ namespace sdl {
          * @brief - Used to retrieve the label widget displaying the current slider's value.
          *          This method can be used in case the label should be fetched to update its
          *          value for example.
-         *          This method is merely a wrapper around the `getChildAs` method and is
-         *          guaranteed to return a valid value if it returns.
+         *          The label is resolved when building the slider so this method is cheap
+         *          and is guaranteed to return a valid value if it returns.
          * @return - the label widget holding the current slider's value.
          */
         LabelWidget*
@@ -337,7 +338,7 @@ namespace sdl {
         loadSlider();
 
         /**
-         * @brief - Clear the textures representing the slider's elements, i.e. the `m_rulerLine`
+         * @brief - Release the textures representing the slider's elements, i.e. the `m_rulerLine`
          *          and the `m_mobileArea` representing respectively the horizontal line ruling
          *          the slider and the rectangle mobile area that can be used to change the value.
          */
@@ -449,6 +450,19 @@ namespace sdl {
          */
         bool m_sliderChanged;
 
+        /**
+         * @brief - Describes whether the value displayed by the label should be updated
+         *          during the next `drawContentPrivate` operation. This allows to update
+         *          the text at most once per frame no matter how many values are set.
+         */
+        bool m_labelChanged;
+
+        /**
+         * @brief - The label displaying the current value of the slider, resolved when
+         *          building the slider.
+         */
+        ChildHandle<LabelWidget> m_valueLabel;
+
         /**
          * @brief - A virtual layout item which allows to position the slider's visual data
          *          (i.e. the horizontal and vertical area which the user can use to change
@@ -467,8 +481,11 @@ namespace sdl {
          *          to it.
          *          It is valid unless the `m_sliderChanged` value is set to `false` which
          *          usually indicates a resize operation.
+         *          The texture is shared with the sliders having the same size and colors
+         *          and identified by the key.
          */
         utils::Uuid m_rulerLine;
+        std::string m_rulerLineKey;
 
         /**
          * @brief - An identifier holding the texture created to rerpesent the element which
@@ -477,8 +494,10 @@ namespace sdl {
          *          indication of the current value compared to the total range.
          *          Note that this element can only occupy discrete positions on the ruler
          *          line, each position corresponding to a precise step.
+         *          Shared similarly to `m_rulerLine`.
          */
         utils::Uuid m_mobileArea;
+        std::string m_mobileAreaKey;
 
       public:
 
@@ -2,6 +2,7 @@
 # define   SLIDER_HXX
 
 # include "Slider.hh"
+# include "SharedTextures.hh"
 # include <sstream>
 # include <iomanip>
 
@@ -130,7 +131,14 @@ namespace sdl {
     inline
     LabelWidget*
     Slider::getValueLabel() {
-      return getChildAs<LabelWidget>(getValueLabelName());
+      if (!m_valueLabel.valid()) {
+        error(
+          std::string("Could not retrieve value label for slider"),
+          std::string("Slider was not built")
+        );
+      }
+
+      return m_valueLabel.get();
     }
 
     inline
@@ -152,16 +160,9 @@ namespace sdl {
     inline
     void
     Slider::clearSlider() {
-      // Destroy both the ruler line and the mobile area textures.
-      if (m_rulerLine.valid()) {
-        getEngine().destroyTexture(m_rulerLine);
-        m_rulerLine.invalidate();
-      }
-
-      if (m_mobileArea.valid()) {
-        getEngine().destroyTexture(m_mobileArea);
-        m_mobileArea.invalidate();
-      }
+      // Release both the ruler line and the mobile area textures.
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_rulerLine, m_rulerLineKey);
+      SharedTextures::getInstance().releaseTexture(getEngine(), m_mobileArea, m_mobileAreaKey);
     }
 
     inline
@@ -262,11 +263,10 @@ namespace sdl {
           if (notify) {
             float value = getValueFromRangeData(m_data);
 
-            // Update the label's text.
-            LabelWidget* label = getValueLabel();
-            if (label != nullptr) {
-              label->setText(stringifyValue(value, m_decimals));
-            }
+            // The label's text is updated at most once per frame in the
+            // next repaint: dragging the slider generates a lot of values
+            // which would never be displayed anyway.
+            m_labelChanged = true;
 
             verbose(
               "Emitting on value changed for " + getName() + " with range " +
@@ -0,0 +1,208 @@
+#ifndef    STATIC_VALIDATOR_HH
+# define   STATIC_VALIDATOR_HH
+
+# include <memory>
+# include <string>
+# include <tuple>
+# include <string_view>
+# include "Validator.hh"
+# include "Validator_utils.hxx"
+
+namespace sdl {
+  namespace graphic {
+
+    namespace validation {
+
+      using State = Validator::State;
+
+      /**
+       * @brief - Produces the verdict shared by all rules: a string which does not
+       *          follow the grammar of a number is invalid while an incomplete one
+       *          (like `-` or `1e`) is intermediate. Rules only refine this verdict
+       *          and return `Valid` when they have nothing to object.
+       * @param components - the components of the number.
+       * @return - the base verdict for the number.
+       */
+      State
+      completeness(const number::Components& components) noexcept;
+
+      /**
+       * @brief - Rule accepting only integer values: any decimal separator or exponent
+       *          makes the input invalid.
+       */
+      struct Integer {
+        State
+        check(const number::Components& components) const noexcept;
+      };
+
+      /**
+       * @brief - Rule accepting values which lie in the range `[lower; upper]`. Values
+       *          out of the range are considered intermediate if appending characters
+       *          to them can still bring them in the range and invalid otherwise.
+       *          The type `T` describes how the input is converted: using `int` will
+       *          reject any decimal separator or exponent.
+       */
+      template <typename T>
+      class Range {
+        public:
+
+          constexpr
+          Range(T lower,
+                T upper) noexcept;
+
+          State
+          check(const number::Components& components) const noexcept;
+
+        private:
+
+          /**
+           * @brief - Used to determine whether appending characters to the number of
+           *          magnitude `magnitude` can produce a value in the range.
+           * @param components - the components of the number.
+           * @param magnitude - the absolute value of the number.
+           * @return - `true` if the range can still be reached.
+           */
+          bool
+          canReach(const number::Components& components,
+                   long double magnitude) const noexcept;
+
+          /**
+           * @brief - Used to determine whether the interval `[lo; hi]` of magnitudes
+           *          intersects the range once the sign of the number is applied.
+           * @param negative - `true` if the number is negative.
+           * @param lo - the lower magnitude of the interval.
+           * @param hi - the upper magnitude of the interval.
+           * @return - `true` if the interval intersects the range.
+           */
+          bool
+          intersects(bool negative,
+                     long double lo,
+                     long double hi) const noexcept;
+
+        private:
+
+          T m_lower;
+          T m_upper;
+      };
+
+      /**
+       * @brief - Rule enforcing the notation of the number. In `Standard` notation no
+       *          exponent is allowed while in `Scientific` notation the leading part
+       *          has at most one digit and an exponent is expected for the value to
+       *          be valid.
+       */
+      template <number::Notation N>
+      struct Notation {
+        State
+        check(const number::Components& components) const noexcept;
+      };
+
+      /**
+       * @brief - Rule limiting the number of digits after the decimal separator.
+       */
+      class MaxDecimals {
+        public:
+
+          explicit constexpr
+          MaxDecimals(unsigned count) noexcept;
+
+          State
+          check(const number::Components& components) const noexcept;
+
+        private:
+
+          unsigned m_count;
+      };
+
+    }
+
+    /**
+     * @brief - Validator combining a set of rules at compile time. Each rule provides a
+     *          `check` method producing a verdict from the components of the input and
+     *          the most restrictive verdict is kept. As the rules are known at compile
+     *          time the checks are inlined and no virtual call nor allocation happens.
+     *          This validator can be used on its own or be wrapped into a `Validator`
+     *          (see `makeValidator`) to be assigned to a text box.
+     */
+    template <typename... Rules>
+    class StaticValidator {
+      public:
+
+        constexpr
+        StaticValidator(Rules... rules) noexcept;
+
+        /**
+         * @brief - Validates the input string against all the rules.
+         * @param input - the input string to validate.
+         * @return - the most restrictive verdict among the rules.
+         */
+        Validator::State
+        validate(std::string_view input) const noexcept;
+
+        /**
+         * @brief - Validates the number described by the input components against all
+         *          the rules. The evaluation stops as soon as a rule returns `Invalid`.
+         * @param components - the components of the number to validate.
+         * @return - the most restrictive verdict among the rules.
+         */
+        Validator::State
+        evaluate(const number::Components& components) const noexcept;
+
+      private:
+
+        std::tuple<Rules...> m_rules;
+    };
+
+    /**
+     * @brief - Adapter allowing to use a `StaticValidator` wherever a `Validator` is
+     *          expected. The number being edited is kept in the validation context so
+     *          that edits at the end of the text are validated incrementally.
+     */
+    template <typename... Rules>
+    class StaticValidatorAdapter: public Validator {
+      public:
+
+        StaticValidatorAdapter(const StaticValidator<Rules...>& validator);
+
+        ~StaticValidatorAdapter() = default;
+
+        State
+        validate(const std::string& input) const override;
+
+        ContextShPtr
+        createContext() const override;
+
+      protected:
+
+        void
+        validateRange(const std::string_view* inputs,
+                      std::size_t count,
+                      State* states) const override;
+
+        bool
+        canValidateConcurrently() const noexcept override;
+
+        State
+        evaluate(const number::Components& number) const noexcept override;
+
+      private:
+
+        StaticValidator<Rules...> m_validator;
+    };
+
+    /**
+     * @brief - Convenience method to wrap the input static validator into a dynamic
+     *          validator which can be assigned to a text box.
+     * @param validator - the static validator to wrap.
+     * @return - a validator delegating the checks to the static validator.
+     */
+    template <typename... Rules>
+    ValidatorShPtr
+    makeValidator(const StaticValidator<Rules...>& validator);
+
+  }
+}
+
+# include "StaticValidator.hxx"
+
+#endif    /* STATIC_VALIDATOR_HH */
@@ -0,0 +1,279 @@
+#ifndef    STATIC_VALIDATOR_HXX
+# define   STATIC_VALIDATOR_HXX
+
+# include "StaticValidator.hh"
+
+# include <cmath>
+# include <type_traits>
+
+namespace sdl {
+  namespace graphic {
+
+    namespace validation {
+
+      inline
+      State
+      completeness(const number::Components& components) noexcept {
+        if (components.invalid > 0u) {
+          return State::Invalid;
+        }
+
+        return (number::isComplete(components) ? State::Valid : State::Intermediate);
+      }
+
+      inline
+      State
+      Integer::check(const number::Components& components) const noexcept {
+        return (components.separator || components.exponent ? State::Invalid : State::Valid);
+      }
+
+      template <typename T>
+      inline
+      constexpr
+      Range<T>::Range(T lower,
+                      T upper) noexcept:
+        m_lower(std::min(lower, upper)),
+        m_upper(std::max(lower, upper))
+      {
+        static_assert(std::is_arithmetic_v<T>, "Range is only defined for arithmetic types");
+      }
+
+      template <typename T>
+      inline
+      State
+      Range<T>::check(const number::Components& components) const noexcept {
+        // Incomplete numbers cannot be converted: the base verdict already
+        // handles them.
+        if (!number::isComplete(components)) {
+          return State::Valid;
+        }
+
+        long double magnitude = 0.0l;
+
+        if constexpr (std::is_integral_v<T>) {
+          if (components.separator || components.exponent || components.leadDigits - components.leadZeros > number::maxDigits) {
+            return State::Invalid;
+          }
+
+          magnitude = static_cast<long double>(components.lead);
+        }
+        else {
+          float value = 0.0f;
+          if (!number::toFloat(components, value)) {
+            return State::Invalid;
+          }
+
+          magnitude = std::fabs(static_cast<long double>(value));
+        }
+
+        const bool negative = (components.sign == '-');
+        const long double value = (negative ? -magnitude : magnitude);
+
+        if (value >= static_cast<long double>(m_lower) && value <= static_cast<long double>(m_upper)) {
+          return State::Valid;
+        }
+
+        return (canReach(components, magnitude) ? State::Intermediate : State::Invalid);
+      }
+
+      template <typename T>
+      inline
+      bool
+      Range<T>::canReach(const number::Components& components,
+                         long double magnitude) const noexcept
+      {
+        const bool negative = (components.sign == '-');
+
+        // Appending digits to the exponent can change the magnitude of the value
+        // by any amount: we can't say anything at this point.
+        if (components.exponent) {
+          return true;
+        }
+
+        // Appending decimals keeps the value in `[magnitude; magnitude + 10^-d]`
+        // where `d` is the current number of decimals.
+        if (components.separator) {
+          long double step = 1.0l;
+          for (unsigned id = 0u ; id < components.decDigits ; ++id) {
+            step /= 10.0l;
+          }
+
+          return intersects(negative, magnitude, magnitude + step);
+        }
+
+        // Floating point values can still receive a decimal separator.
+        if constexpr (!std::is_integral_v<T>) {
+          if (intersects(negative, magnitude, magnitude + 1.0l)) {
+            return true;
+          }
+        }
+
+        // Appending `k` digits moves the magnitude in `[m * 10^k; (m + 1) * 10^k[`:
+        // try each count until the interval goes past the range.
+        const long double limit = std::max(
+          std::fabs(static_cast<long double>(m_lower)),
+          std::fabs(static_cast<long double>(m_upper))
+        );
+        // Integral types have at most `digits10 + 1` digits while floating point
+        // types can hold up to `max_exponent10 + 1` leading digits.
+        const int maxDigits = 1 + (
+          std::is_integral_v<T> ?
+          std::numeric_limits<T>::digits10 :
+          std::numeric_limits<T>::max_exponent10
+        );
+
+        long double lo = magnitude;
+        long double hi = magnitude + 1.0l;
+
+        for (int digits = 0 ; digits < maxDigits ; ++digits) {
+          lo *= 10.0l;
+          hi *= 10.0l;
+
+          if (lo > limit) {
+            break;
+          }
+
+          if (intersects(negative, lo, (std::is_integral_v<T> ? hi - 1.0l : hi))) {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+      template <typename T>
+      inline
+      bool
+      Range<T>::intersects(bool negative,
+                           long double lo,
+                           long double hi) const noexcept
+      {
+        const long double first = (negative ? -hi : lo);
+        const long double last = (negative ? -lo : hi);
+
+        return first <= static_cast<long double>(m_upper) && last >= static_cast<long double>(m_lower);
+      }
+
+      template <number::Notation N>
+      inline
+      State
+      Notation<N>::check(const number::Components& components) const noexcept {
+        if constexpr (N == number::Notation::Standard) {
+          return (components.exponent ? State::Invalid : State::Valid);
+        }
+        else {
+          if (components.leadDigits - components.leadZeros > 1u) {
+            return State::Invalid;
+          }
+
+          return (components.exponent ? State::Valid : State::Intermediate);
+        }
+      }
+
+      inline
+      constexpr
+      MaxDecimals::MaxDecimals(unsigned count) noexcept:
+        m_count(count)
+      {}
+
+      inline
+      State
+      MaxDecimals::check(const number::Components& components) const noexcept {
+        return (components.decDigits > m_count ? State::Invalid : State::Valid);
+      }
+
+    }
+
+    template <typename... Rules>
+    inline
+    constexpr
+    StaticValidator<Rules...>::StaticValidator(Rules... rules) noexcept:
+      m_rules(rules...)
+    {}
+
+    template <typename... Rules>
+    inline
+    Validator::State
+    StaticValidator<Rules...>::validate(std::string_view input) const noexcept {
+      return evaluate(number::parse(input));
+    }
+
+    template <typename... Rules>
+    inline
+    Validator::State
+    StaticValidator<Rules...>::evaluate(const number::Components& components) const noexcept {
+      Validator::State state = validation::completeness(components);
+
+      // Keep the most restrictive verdict and stop at the first rule which
+      // rejects the input.
+      std::apply(
+        [&state, &components](const Rules&... rules) {
+          (void)(((state = std::min(state, rules.check(components))) != Validator::State::Invalid) && ...);
+        },
+        m_rules
+      );
+
+      return state;
+    }
+
+    template <typename... Rules>
+    inline
+    StaticValidatorAdapter<Rules...>::StaticValidatorAdapter(const StaticValidator<Rules...>& validator):
+      Validator(std::string("static_validator")),
+
+      m_validator(validator)
+    {
+      // Nothing to do.
+    }
+
+    template <typename... Rules>
+    inline
+    Validator::State
+    StaticValidatorAdapter<Rules...>::validate(const std::string& input) const {
+      return m_validator.validate(input);
+    }
+
+    template <typename... Rules>
+    inline
+    Validator::ContextShPtr
+    StaticValidatorAdapter<Rules...>::createContext() const {
+      return std::make_shared<NumberContext>();
+    }
+
+    template <typename... Rules>
+    inline
+    void
+    StaticValidatorAdapter<Rules...>::validateRange(const std::string_view* inputs,
+                                                    std::size_t count,
+                                                    State* states) const
+    {
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        states[id] = m_validator.validate(inputs[id]);
+      }
+    }
+
+    template <typename... Rules>
+    inline
+    bool
+    StaticValidatorAdapter<Rules...>::canValidateConcurrently() const noexcept {
+      return true;
+    }
+
+    template <typename... Rules>
+    inline
+    Validator::State
+    StaticValidatorAdapter<Rules...>::evaluate(const number::Components& number) const noexcept {
+      return m_validator.evaluate(number);
+    }
+
+    template <typename... Rules>
+    inline
+    ValidatorShPtr
+    makeValidator(const StaticValidator<Rules...>& validator) {
+      return std::make_shared<StaticValidatorAdapter<Rules...>>(validator);
+    }
+
+  }
+}
+
+#endif    /* STATIC_VALIDATOR_HXX */
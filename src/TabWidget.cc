@@ -1,6 +1,7 @@
 
 # include "TabWidget.hh"
 # include "LabelWidget.hh"
+# include <algorithm>
 
 namespace sdl {
   namespace graphic {
@@ -12,8 +13,15 @@ namespace sdl {
       core::SdlWidget(name, area, parent),
       m_tabLayout(tabLayout),
       m_titlesLayout(nullptr),
+      m_selector(),
       m_tabCount(0u),
-      m_tabs()
+      m_tabs(),
+      m_freeTabs(),
+      m_tabsIDs(),
+      m_titlesToTabs(),
+      m_itemsToTabs(),
+
+      m_hibernationDelay(0)
     {
       build();
     }
@@ -22,8 +30,30 @@ namespace sdl {
 
     void
     TabWidget::insertTab(int index,
-                         core::SdlWidget* item,
+                         const std::string& name,
+                         const TabFactory& factory,
                          const std::string& text)
+    {
+      // Check trivial case where the factory is not valid.
+      if (!factory) {
+        error(
+          std::string("Cannot insert tab \"") + name + "\" in tabwidget",
+          std::string("Invalid null factory")
+        );
+      }
+
+      // The tab is represented by an empty selector which will receive
+      // the content of the tab when it is created.
+      SelectorWidget* host = new SelectorWidget(name, nullptr);
+
+      insertTabPrivate(index, host, (text.empty() ? name : text), factory);
+    }
+
+    void
+    TabWidget::insertTabPrivate(int index,
+                                core::SdlWidget* item,
+                                const std::string& text,
+                                const TabFactory& factory)
     {
       // Check trivial case where the item is not valid.
       if (item == nullptr) {
@@ -33,6 +63,9 @@ namespace sdl {
         );
       }
 
+      // Clamp the index to the valid range of positions.
+      index = std::min(std::max(index, 0), getTabsCount());
+
       // We only need to insert a tab title if the tab to insert is
       // not alone in the widget. Indeed if we only have one tab we
       // want to maximize the area available for the content and thus
@@ -45,14 +78,21 @@ namespace sdl {
         title = item->getName();
       }
 
-      if (m_tabs.empty()) {
-        // Insert the tab into the internal `m_tabs` array but do not
-        // trigger the creation of a title widget.
-        m_tabs.push_back(
+      if (getTabsCount() == 0) {
+        // Register the tab internally but do not trigger the creation
+        // of a title widget.
+        registerTab(
+          index,
           TabInfo{
             item->getName(),
+            ChildHandle<core::SdlWidget>(),
             getTitleNameFromTabID(),
-            title
+            title,
+
+            TabFactory(),
+            ChildHandle<SelectorWidget>(),
+            nullptr,
+            std::chrono::steady_clock::now()
           }
         );
       }
@@ -60,8 +100,9 @@ namespace sdl {
         // Check whether we should create the first item title widget:
         // this occurs when we are inserting the second tab into this
         // widget.
-        if (m_tabs.size() == 1u) {
-          createTitleForWidget(0u, m_tabs[0].tabName, m_tabs[0].itemName, item->getPalette(), false);
+        if (getTabsCount() == 1) {
+          const TabInfo& first = getTab(0);
+          createTitleForWidget(0u, first.tabName, first.itemName, item->getPalette(), false);
         }
 
         // Use the dedicated handler to create the title widget for the
@@ -70,20 +111,32 @@ namespace sdl {
 
         // Activate the titles layout if needed (i.e. if at least two
         // tabs have been registered into this widget).
-        if (m_tabs.size() > 1u) {
+        if (getTabsCount() > 1) {
           m_titlesLayout->setVisible(true);
           invalidate();
         }
       }
 
+      // Attach the content of the tab: either the item itself or the
+      // factory which will create it. Tabs created from a factory are
+      // always represented by a selector (see `insertTab`).
+      TabInfo& tab = getTab(index);
+      tab.item.reset(item);
+      tab.factory = factory;
+      tab.host.reset(factory ? static_cast<SelectorWidget*>(item) : nullptr);
+      tab.content = (factory ? nullptr : item);
+
       // First insert the widget into the selector layout.
       getSelector().insertWidget(item, index);
+
+      // The inserted tab might have become the active one.
+      buildTab(getSelector().getActiveItem());
     }
 
     void
     TabWidget::removeTab(int index) {
       // Try to find the name associated whith the input `index`.
-      if (index < 0 || index >= static_cast<int>(m_tabs.size())) {
+      if (index < 0 || index >= getTabsCount()) {
         error(
           std::string("Cannot remove item ") + std::to_string(index) + " from tabwidget",
           std::string("No such item")
@@ -99,10 +152,9 @@ namespace sdl {
 
       // 1. Remove the item from the selector layout. To do so
       // we need first to retrieve the child associated to the
-      // input `index`. We have to traverse the internal table
-      // to associate a name to the `index` and then rely on
-      // the base method to retrieve the child from the name.
-      core::SdlWidget* item = getChildAs<core::SdlWidget>(m_tabs[index].itemName);
+      // input `index` which is kept in the internal table.
+      const TabInfo& tab = getTab(index);
+      core::SdlWidget* item = tab.item.get();
       if (item == nullptr) {
         error(
           std::string("Could not remove item ") + std::to_string(index) + " from tabwidget",
@@ -110,7 +162,17 @@ namespace sdl {
         );
       }
 
-      getSelector().removeItem(item);
+      // In case the widget has been deleted externally it is not
+      // part of the selector anymore: we only need to clean the
+      // internal data.
+      const bool attached = hasTabWidget(tab);
+
+      if (attached) {
+        getSelector().removeItem(item);
+      }
+      else {
+        warn("Widget for tab \"" + tab.tabName + "\" was deleted externally");
+      }
 
       // 2. Remove the item from the titles layout if needed.
       // We will also make the titles layout hidden if the tabs
@@ -121,8 +183,22 @@ namespace sdl {
         m_titlesLayout->setVisible(false);
       }
 
+      // Tabs created from a factory own the host created when
+      // inserting them: as it was only detached from the selector
+      // we need to destroy it (along with its content).
+      const bool owned = attached && static_cast<bool>(tab.factory);
+
       // 3. Update the internal `m_tabs` array.
       removeIndexFromInternal(index);
+
+      if (owned) {
+        delete item;
+      }
+
+      // Another tab might have been activated.
+      if (getTabsCount() > 0) {
+        buildTab(getSelector().getActiveItem());
+      }
     }
 
     void
@@ -135,24 +211,12 @@ namespace sdl {
         );
       }
 
-      // We need to determine the index of this widget in the tabwidget.
-      // To do so we need to use the internal `m_tabs` array which contains
-      // the indices of widgets inserted in this tab along with their names.
-      int id = 0;
-      bool found = false;
-
-      // Traverse the internal `m_tabs` list and find the index for this widget.
-      while (id < getTabsCount() && !found) {
-        if (m_tabs[id].itemName == widget->getName()) {
-          found = true;
-        }
-        else {
-          ++id;
-        }
-      }
+      // We need to determine the index of this widget in the tabwidget: it
+      // can either be the widget representing the tab or its content.
+      const int id = getTabIndex(m_itemsToTabs, widget->getName());
 
       // Check whether we could find the widget.
-      if (!found) {
+      if (id < 0 || (!getTab(id).item.is(widget) && getTab(id).content != widget)) {
         error(
           std::string("Could not remove tab \"") + widget->getName() + "\" from tabwidget",
           std::string("No such tab")
@@ -268,6 +332,8 @@ namespace sdl {
         core::engine::Color::NamedColor::Olive
       );
 
+      m_selector.reset(selector);
+
       // Add the nested titles layout and the selector widget to
       // the general layout for this item.
       switch (m_tabLayout) {
@@ -308,7 +374,7 @@ namespace sdl {
         name = getTitleNameFromTabID();
       }
       else {
-        name = m_tabs[index].titleWidgetName;
+        name = getTab(index).titleWidgetName;
       }
 
       LabelWidget* titleWidget = new LabelWidget(
@@ -341,27 +407,20 @@ namespace sdl {
         return;
       }
 
-      // Create the new version of the tabs data.
-      Tabs newTabs(m_tabs.size() + 1u);
-
-      for (int i = 0u ; i < static_cast<int>(m_tabs.size()) ; ++i) {
-        // We need to keep the name of the tab at the same position if its
-        // index is smaller than the input `index` and move it one setp
-        // further if it is greater.
-        if (i < index) {
-          newTabs[i] = m_tabs[i];
-        }
-        else {
-          newTabs[i + 1] = m_tabs[i];
+      registerTab(
+        index,
+        TabInfo{
+          item,
+          ChildHandle<core::SdlWidget>(),
+          name,
+          text,
+
+          TabFactory(),
+          ChildHandle<SelectorWidget>(),
+          nullptr,
+          std::chrono::steady_clock::now()
         }
-      }
-      newTabs[index] = TabInfo{
-        item,
-        name,
-        text
-      };
-
-      m_tabs.swap(newTabs);
+      );
     }
 
     void
@@ -369,52 +428,167 @@ namespace sdl {
       // Retrieve the index of the tab based on the name of the title widget which has
       // been clicked.
 
-      int id = 0;
-      bool found = false;
-      while (!found && id < getTabsCount()) {
-        verbose("Trying to activate \"" + name + "\", item " + std::to_string(id) + " has item name \"" + m_tabs[id].itemName + "\" and tab name \"" + m_tabs[id].tabName + "\" and title name \"" + m_tabs[id].titleWidgetName + "\"");
-        if (m_tabs[id].titleWidgetName == name) {
-          found = true;
-        }
-        else {
-          ++id;
-        }
-      }
+      const int id = getTabIndex(m_titlesToTabs, name);
 
       debug("Clicked on tab " + name + " which is on id " + std::to_string(id));
 
       // Check for errors.
-      if (!found) {
+      if (id < 0) {
         warn("Could not activate widget from clicked title \"" + name + "\"");
         return;
       }
 
       // Activate the item.
-      getSelector().setActiveWidget(id);
+      activateTab(id);
+    }
+
+    int
+    TabWidget::registerTab(int index,
+                           const TabInfo& info)
+    {
+      // Reuse the slot of a removed tab if possible so that the storage
+      // does not grow.
+      int physID = static_cast<int>(m_tabs.size());
+      if (!m_freeTabs.empty()) {
+        physID = m_freeTabs.back();
+        m_freeTabs.pop_back();
+
+        m_tabs[physID] = info;
+      }
+      else {
+        m_tabs.push_back(info);
+      }
+
+      m_titlesToTabs[info.titleWidgetName] = physID;
+      m_itemsToTabs[info.itemName] = physID;
+
+      return m_tabsIDs.insert(index, physID);
     }
 
     void
     TabWidget::removeIndexFromInternal(int index) {
-      // Create a new list and populate it with the new data.
-      Tabs newTabs(m_tabs.size() - 1u);
-
-      for (int i = 0u ; i < static_cast<int>(m_tabs.size()) ; ++i) {
-        // We need to keep the name of the tab at the same position if its
-        // index is smaller than the input `index` and move it one setp
-        // closer if it is greater.
-        if (i < index) {
-          newTabs[i] = m_tabs[i];
-        }
-        else if (i == index) {
-          // Ignore the tab to delete.
+      const int physID = m_tabsIDs.getPhysicalID(index);
+      TabInfo& tab = m_tabs[physID];
+
+      m_titlesToTabs.erase(tab.titleWidgetName);
+      m_itemsToTabs.erase(tab.itemName);
+      if (tab.content != nullptr && hasTabWidget(tab)) {
+        unregisterContent(tab.content->getName(), physID);
+      }
+      else if (tab.content != nullptr) {
+        // The content was deleted along with the widget of the tab: we
+        // can't retrieve its name anymore.
+        std::erase_if(
+          m_itemsToTabs,
+          [physID](const Lookup::value_type& entry) {
+            return entry.second == physID;
+          }
+        );
+      }
+
+      // Release the data of the tab and make its slot available.
+      tab = TabInfo();
+      m_freeTabs.push_back(physID);
+
+      m_tabsIDs.erase(index);
+    }
+
+    void
+    TabWidget::unregisterContent(const std::string& name,
+                                 int physID)
+    {
+      Lookup::const_iterator it = m_itemsToTabs.find(name);
+      if (it != m_itemsToTabs.cend() && it->second == physID) {
+        m_itemsToTabs.erase(it);
+      }
+    }
+
+    void
+    TabWidget::activateTab(int index) {
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+      // The tab which was displayed becomes idle from now on.
+      const int previous = getSelector().getActiveItem();
+      if (previous >= 0 && previous < getTabsCount()) {
+        getTab(previous).lastActive = now;
+      }
+
+      buildTab(index);
+      getSelector().setActiveWidget(index);
+
+      getTab(index).lastActive = now;
+
+      hibernateIdleTabs();
+    }
+
+    void
+    TabWidget::buildTab(int index) {
+      TabInfo& tab = getTab(index);
+
+      if (!tab.factory || tab.content != nullptr) {
+        return;
+      }
+
+      SelectorWidget* host = (hasTabWidget(tab) ? tab.host.get() : nullptr);
+      if (host == nullptr) {
+        error(
+          std::string("Could not create content of tab ") + std::to_string(index),
+          std::string("No associated widget")
+        );
+      }
+
+      core::SdlWidget* content = tab.factory();
+      if (content == nullptr) {
+        error(
+          std::string("Could not create content of tab ") + std::to_string(index),
+          std::string("Factory returned null widget")
+        );
+      }
+
+      host->insertWidget(content, 0);
+
+      tab.content = content;
+      tab.lastActive = std::chrono::steady_clock::now();
+
+      // The content can also be used to reference the tab.
+      m_itemsToTabs.emplace(content->getName(), m_tabsIDs.getPhysicalID(index));
+    }
+
+    void
+    TabWidget::hibernateIdleTabs() {
+      if (m_hibernationDelay.count() <= 0) {
+        return;
+      }
+
+      const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+      const int active = m_tabsIDs.getPhysicalID(getSelector().getActiveItem());
+
+      // Slots of removed tabs do not have any factory: we can traverse the
+      // storage directly.
+      for (int id = 0 ; id < static_cast<int>(m_tabs.size()) ; ++id) {
+        TabInfo& tab = m_tabs[id];
+
+        if (id == active || !tab.factory || tab.content == nullptr || now - tab.lastActive < m_hibernationDelay) {
+          continue;
         }
-        else {
-          newTabs[i - 1] = m_tabs[i];
+
+        SelectorWidget* host = (hasTabWidget(tab) ? tab.host.get() : nullptr);
+        if (host == nullptr) {
+          warn("Could not hibernate tab \"" + tab.tabName + "\", no associated widget");
+          continue;
         }
-      }
 
-      // Swap the new data with the internal list.
-      m_tabs.swap(newTabs);
+        // Destroying the content releases all the textures of its hierarchy:
+        // it will be created again by the factory when needed.
+        verbose("Hibernating tab \"" + tab.tabName + "\" after " + std::to_string(m_hibernationDelay.count()) + "ms");
+
+        unregisterContent(tab.content->getName(), id);
+
+        host->removeItem(tab.content);
+        delete tab.content;
+
+        tab.content = nullptr;
+      }
     }
 
   }
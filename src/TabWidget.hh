@@ -1,9 +1,14 @@
 #ifndef    TAB_WIDGET_HH
 # define   TAB_WIDGET_HH
 
+# include <chrono>
 # include <memory>
 # include <vector>
+# include <functional>
 # include <sdl_core/SdlWidget.hh>
+# include <unordered_map>
+# include "IdsMapping.hh"
+# include "ChildHandle.hh"
 # include "LinearLayout.hh"
 # include "SelectorWidget.hh"
 
@@ -24,6 +29,12 @@ namespace sdl {
           East   //<! - Tab indication will be displayed on the right of the content.
         };
 
+        /**
+         * @brief - Convenience define to refer to a function creating the content of a tab.
+         *          The returned widget should not have any parent.
+         */
+        using TabFactory = std::function<core::SdlWidget*()>;
+
       public:
 
         TabWidget(const std::string& name,
@@ -59,6 +70,36 @@ namespace sdl {
                   core::SdlWidget* item,
                   const std::string& text = std::string());
 
+        /**
+         * @brief - Similar to `insertTab` but the content of the tab is only created by
+         *          the `factory` when the tab is activated for the first time. Until then
+         *          an empty widget named `name` stands for the tab.
+         *          Such tabs can also be hibernated when they stay inactive for too long
+         *          (see `setHibernationDelay`): the content is then destroyed, releasing
+         *          all its textures, and created again with the factory upon the next
+         *          activation.
+         * @param index - the position where the tab widget should be inserted.
+         * @param name - the name of the widget standing for the tab.
+         * @param factory - the function creating the content of the tab.
+         * @param text - a string representing the name under which the item should be
+         *               referenced in the title bar. If no name is provided the `name`
+         *               will be used.
+         */
+        void
+        insertTab(int index,
+                  const std::string& name,
+                  const TabFactory& factory,
+                  const std::string& text = std::string());
+
+        /**
+         * @brief - Defines the time after which the content of an inactive tab inserted
+         *          with a factory is destroyed. The delay is checked whenever the active
+         *          tab changes. A value of `0` (the default) disables the hibernation.
+         * @param delay - the time after which inactive tabs are hibernated.
+         */
+        void
+        setHibernationDelay(const std::chrono::milliseconds& delay) noexcept;
+
         /**
          * @brief - Used to remove the tab widget located at index `index`. If no such
          *          index exists in this component an error is raised.
@@ -121,7 +162,7 @@ namespace sdl {
                              bool updateIDs = true);
 
         /**
-         * @brief - Wrapper around the parent `getChildAs` method for better convenience.
+         * @brief - Retrieves the selector widget resolved when building this tab widget.
          *          Note that if the selector widget cannot be found an error is raised.
          * @return - a reference to the selector widget associated to this tab layout.
          */
@@ -154,26 +195,132 @@ namespace sdl {
         getSelectorName() const noexcept;
 
         /**
-         * @brief - Removes the specified `index` from the internal `m_tabs` list. No controls
-         *          are performed to verify whether the `index` is valid.
+         * @brief - Removes the specified `index` from the internal tabs. No controls are
+         *          performed to verify whether the `index` is valid.
          * @param index - the index to remove from the internal list.
          */
         void
         removeIndexFromInternal(int index);
 
+        /**
+         * @brief - Used to insert the tab represented by `item` and attach the `factory`
+         *          to it if it is valid. This is the common part of the public overloads
+         *          of `insertTab`.
+         * @param index - the position where the tab widget should be inserted.
+         * @param item - the widget representing the tab in the selector.
+         * @param text - the title of the tab.
+         * @param factory - the function creating the content of the tab, might be empty
+         *                  in which case `item` is the content.
+         */
+        void
+        insertTabPrivate(int index,
+                         core::SdlWidget* item,
+                         const std::string& text,
+                         const TabFactory& factory);
+
+        /**
+         * @brief - Used to activate the tab at `index` in the selector, creating its content
+         *          if needed. The tabs which became idle are also hibernated.
+         * @param index - the index of the tab to activate.
+         */
+        void
+        activateTab(int index);
+
+        /**
+         * @brief - Creates the content of the tab at `index` if it was inserted with a factory
+         *          and is not yet created. Nothing happens otherwise.
+         * @param index - the index of the tab to create.
+         */
+        void
+        buildTab(int index);
+
+        /**
+         * @brief - Destroys the content of the inactive tabs created from a factory which
+         *          were not used for longer than the hibernation delay.
+         */
+        void
+        hibernateIdleTabs();
+
       private:
 
         /**
-         * @brief - Convenience structure recording information about a tab.
+         * @brief - Convenience structure recording information about a tab. For tabs
+         *          created from a `factory` the `item` stands for the tab in the selector
+         *          and the `content` is only valid when the factory has been used. The
+         *          `lastActive` describes the last time the tab was displayed.
+         *          The `host` is the selector created to receive the content of tabs with
+         *          a factory: it is the same widget as the `item`.
          */
         struct TabInfo {
           std::string itemName;
+          ChildHandle<core::SdlWidget> item;
           std::string titleWidgetName;
           std::string tabName;
+
+          TabFactory factory;
+          ChildHandle<SelectorWidget> host;
+          core::SdlWidget* content;
+          std::chrono::steady_clock::time_point lastActive;
         };
 
         using Tabs = std::vector<TabInfo>;
 
+        /**
+         * @brief - Associates a name to the slot of a tab in the internal storage.
+         */
+        using Lookup = std::unordered_map<std::string, int>;
+
+        /**
+         * @brief - Retrieves the information about the tab at `index`. No controls are
+         *          performed to verify whether the `index` is valid.
+         * @param index - the index of the tab.
+         * @return - the information about the tab.
+         */
+        TabInfo&
+        getTab(int index);
+
+        /**
+         * @brief - Used to determine whether the widget representing the `tab` is still
+         *          part of this tab widget. The widgets inserted as tabs are provided by
+         *          the user and might be deleted externally: in this case the handles of
+         *          the tab (and its content) should not be dereferenced.
+         * @param tab - the tab to check.
+         * @return - `true` if the widget of the tab still exists.
+         */
+        bool
+        hasTabWidget(const TabInfo& tab) const noexcept;
+
+        /**
+         * @brief - Retrieves the index of the tab associated to `name` in the `lookup`.
+         * @param lookup - the table to search.
+         * @param name - the name to search for.
+         * @return - the index of the tab or `-1` if `name` is not associated to any tab.
+         */
+        int
+        getTabIndex(const Lookup& lookup,
+                    const std::string& name) const noexcept;
+
+        /**
+         * @brief - Registers the `info` as the tab at `index` in the internal storage and
+         *          updates the lookup tables.
+         * @param index - the index of the new tab.
+         * @param info - the information about the tab.
+         * @return - the index at which the tab was actually inserted.
+         */
+        int
+        registerTab(int index,
+                    const TabInfo& info);
+
+        /**
+         * @brief - Removes the association between the content of a tab and its slot if
+         *          it still exists.
+         * @param name - the name of the content.
+         * @param physID - the slot of the tab in the internal storage.
+         */
+        void
+        unregisterContent(const std::string& name,
+                          int physID);
+
         /**
          * @brief - Describes the position of the tab titles relatively to the tab content. Based
          *          on the orientation of the tabs, the titles may be displayed horizontally or
@@ -189,6 +336,11 @@ namespace sdl {
          */
         LinearLayoutShPtr m_titlesLayout;
 
+        /**
+         * @brief - The selector displaying the content of the tabs.
+         */
+        ChildHandle<SelectorWidget> m_selector;
+
         /**
          * @brief - A counter which is incremented at each tab creation: allows to provide unique
          *          naming for each tab of this widget thus making sure that they will not be
@@ -197,11 +349,33 @@ namespace sdl {
         unsigned m_tabCount;
 
         /**
-         * @brief - Associates the index of the tab with its name. This allows the user to reference
-         *          tabs by index instead of using their name (which might not have been provided by
-         *          the user).
+         * @brief - Holds the information about each tab. Tabs are stored in the order of their
+         *          creation and their slot is reused once they are removed (see `m_freeTabs`):
+         *          inserting or removing a tab does not need to move the others.
          */
         Tabs m_tabs;
+        std::vector<int> m_freeTabs;
+
+        /**
+         * @brief - Associates the index of the tab as displayed with its slot in `m_tabs`. This
+         *          allows the user to reference tabs by index instead of using their name (which
+         *          might not have been provided by the user).
+         */
+        IdsMapping m_tabsIDs;
+
+        /**
+         * @brief - Associates the name of the title widgets and of the items representing the
+         *          tabs (or their content) to their slot in `m_tabs`. This allows to find the tab
+         *          corresponding to a click on a title in constant time.
+         */
+        Lookup m_titlesToTabs;
+        Lookup m_itemsToTabs;
+
+        /**
+         * @brief - The time after which the content of inactive tabs created from a factory
+         *          is destroyed. A value of `0` means that tabs are never hibernated.
+         */
+        std::chrono::milliseconds m_hibernationDelay;
     };
 
     using TabWidgetShPtr = std::shared_ptr<TabWidget>;
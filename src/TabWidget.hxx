@@ -9,7 +9,47 @@ namespace sdl {
     inline
     int
     TabWidget::getTabsCount() const noexcept {
-      return m_tabs.size();
+      return m_tabsIDs.size();
+    }
+
+    inline
+    void
+    TabWidget::insertTab(int index,
+                         core::SdlWidget* item,
+                         const std::string& text)
+    {
+      insertTabPrivate(index, item, text, TabFactory());
+    }
+
+    inline
+    void
+    TabWidget::setHibernationDelay(const std::chrono::milliseconds& delay) noexcept {
+      m_hibernationDelay = delay;
+    }
+
+    inline
+    TabWidget::TabInfo&
+    TabWidget::getTab(int index) {
+      return m_tabs[m_tabsIDs.getPhysicalID(index)];
+    }
+
+    inline
+    bool
+    TabWidget::hasTabWidget(const TabInfo& tab) const noexcept {
+      return tab.item.valid() && hasChild(tab.item.getName());
+    }
+
+    inline
+    int
+    TabWidget::getTabIndex(const Lookup& lookup,
+                           const std::string& name) const noexcept
+    {
+      Lookup::const_iterator it = lookup.find(name);
+      if (it == lookup.cend()) {
+        return -1;
+      }
+
+      return m_tabsIDs.getLogicalID(it->second);
     }
 
     inline
@@ -21,16 +61,14 @@ namespace sdl {
     inline
     SelectorWidget&
     TabWidget::getSelector() {
-      SelectorWidget* selector = getChildAs<SelectorWidget>(getSelectorName());
-
-      if (selector == nullptr) {
+      if (!m_selector.valid()) {
         error(
           std::string("Cannot retrieve selector widget from tabwidget"),
           std::string("No such widget")
         );
       }
 
-      return *selector;
+      return *m_selector.get();
     }
 
     inline
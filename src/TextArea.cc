@@ -0,0 +1,661 @@
+
+# include "TextArea.hh"
+# include <cmath>
+# include <iterator>
+# include <algorithm>
+
+namespace sdl {
+  namespace graphic {
+
+    const unsigned TextArea::sk_wheelStep = 3u;
+
+    TextArea::TextArea(const std::string& name,
+                       const std::string& font,
+                       const std::string& text,
+                       unsigned size,
+                       SdlWidget* parent,
+                       const utils::Sizef& area):
+      TextEditWidget(name, font, size, parent, area),
+      m_lines(),
+      m_rendered(),
+      m_trash(),
+
+      m_firstLine(0u),
+
+      m_cursorLine(0u),
+      m_cursorColumn(0u),
+      m_cursorChanged(true),
+
+      m_readOnly(false),
+      m_followTail(true),
+
+      m_lineHeight(0.0f),
+
+      m_textRole(core::engine::Palette::ColorRole::WindowText),
+
+      m_renderedLines(0u),
+
+      onVerticalAxisChanged()
+    {
+      // Build the internal state of this area.
+      build();
+
+      setText(text);
+    }
+
+    TextArea::~TextArea() {
+      // Stop blinking: no callback can be issued on this text area afterwards.
+      // This should happen before anything is destroyed as the callback accesses
+      // the attributes of the text area.
+      stopBlinking();
+
+      // Clear the lines: the glyphs and the font are handled by the base class.
+      clearTextures();
+    }
+
+    void
+    TextArea::setText(std::string_view text) {
+      const std::lock_guard guard(m_propsLocker);
+
+      // Release all the lines rendered so far.
+      for (unsigned id = 0u ; id < m_rendered.size() ; ++id) {
+        if (m_rendered[id] < m_lines.size()) {
+          releaseLine(m_lines[m_rendered[id]]);
+        }
+      }
+
+      m_rendered.clear();
+
+      m_lines.assign(1u, Line{std::string(), utils::Uuid(), utils::Sizef()});
+      insertAt(0u, 0u, text);
+
+      m_firstLine = 0u;
+      m_cursorLine = 0u;
+      m_cursorColumn = 0u;
+      m_cursorChanged = true;
+
+      notifyAxis();
+      requestRepaint();
+    }
+
+    void
+    TextArea::appendText(std::string_view text) {
+      const std::lock_guard guard(m_propsLocker);
+
+      // Determine whether the end of the text is visible before appending the
+      // text: this tells whether the view should follow the new lines and if
+      // a repaint is needed at all.
+      const std::size_t last = m_lines.size() - 1u;
+      const bool atBottom = (m_firstLine >= getMaximumFirstLine());
+      const bool lastVisible = (last >= m_firstLine && last <= m_firstLine + getVisibleLinesCount());
+
+      insertAt(last, m_lines.back().text.size(), text);
+
+      if (m_followTail && atBottom && scrollTo(getMaximumFirstLine())) {
+        return;
+      }
+
+      notifyAxis();
+
+      if (lastVisible) {
+        requestRepaint();
+      }
+    }
+
+    void
+    TextArea::onControlScrolled(scroll::Orientation orientation,
+                                float min,
+                                float max)
+    {
+      // Only vertical scrolling is supported.
+      if (orientation != scroll::Orientation::Vertical) {
+        return;
+      }
+
+      const std::lock_guard guard(m_propsLocker);
+
+      // The top of the range describes the first line to display (remember
+      // that the axis starts from the bottom of the text).
+      const float top = std::min(1.0f, std::max(0.0f, std::max(min, max)));
+      const std::size_t first = static_cast<std::size_t>(std::round((1.0f - top) * m_lines.size()));
+
+      scrollTo(first, false);
+    }
+
+    void
+    TextArea::updatePrivate(const utils::Boxf& window) {
+      // Protect from concurrent accesses.
+      const std::lock_guard guard(m_propsLocker);
+
+      // The cursor is located from the top left corner of the area: its
+      // position is not valid anymore when the area is resized.
+      m_cursorChanged = true;
+      m_cursorArea = utils::Boxf();
+
+      // Also call the parent method to benefit from the base class behavior.
+      core::SdlWidget::updatePrivate(window);
+    }
+
+    void
+    TextArea::drawContentPrivate(const utils::Uuid& uuid,
+                                 const utils::Boxf& area)
+    {
+      // Acquire the lock on the attributes of this widget.
+      const std::lock_guard guard(m_propsLocker);
+
+      // Load the font and the height of lines if needed.
+      loadMetrics();
+
+      // Destroy the textures of lines which were modified since the last draw.
+      for (unsigned id = 0u ; id < m_trash.size() ; ++id) {
+        getEngine().destroyTexture(m_trash[id]);
+      }
+
+      m_trash.clear();
+
+      if (m_lineHeight <= 0.0f) {
+        return;
+      }
+
+      // Now that the height of a line is known, make sure that the view does not
+      // go past the end of the text.
+      if (m_firstLine > getMaximumFirstLine()) {
+        m_firstLine = getMaximumFirstLine();
+        m_cursorChanged = true;
+
+        notifyAxis();
+      }
+
+      utils::Sizef sizeEnv = getEngine().queryTexture(uuid);
+      utils::Boxf env = utils::Boxf::fromSize(sizeEnv, true);
+
+      // The last line might only be partially visible.
+      const std::size_t last = std::min(m_lines.size(), m_firstLine + getVisibleLinesCount() + 1u);
+
+      // Release the lines which were scrolled out of the view: only the lines
+      // entering the view will need to be rendered.
+      for (unsigned id = 0u ; id < m_rendered.size() ; ++id) {
+        const std::size_t line = m_rendered[id];
+
+        if (line < m_lines.size() && (line < m_firstLine || line >= last) && m_lines[line].texture.valid()) {
+          getEngine().destroyTexture(m_lines[line].texture);
+          m_lines[line].texture = utils::Uuid();
+        }
+      }
+
+      m_rendered.clear();
+
+      // Render and draw each visible line.
+      for (std::size_t id = m_firstLine ; id < last ; ++id) {
+        Line& line = m_lines[id];
+
+        if (!line.texture.valid() && !line.text.empty()) {
+          line.texture = getEngine().createTextureFromText(line.text, m_font, m_textRole);
+
+          if (line.texture.valid()) {
+            line.size = getEngine().queryTexture(line.texture);
+            ++m_renderedLines;
+          }
+        }
+
+        if (!line.texture.valid()) {
+          continue;
+        }
+
+        m_rendered.push_back(id);
+
+        // Lines are laid out from the top left corner of the area.
+        const float top = sizeEnv.h() / 2.0f - (id - m_firstLine) * m_lineHeight;
+        const utils::Boxf dst(-sizeEnv.w() / 2.0f + line.size.w() / 2.0f, top - line.size.h() / 2.0f, line.size);
+
+        drawPartOnCanvas(line.texture, dst, uuid, env, area);
+      }
+
+      // Render the cursor if it lies in the visible lines. Its area is kept so
+      // that blinking only repaints this part of the text area.
+      if (!m_cursorVisible || m_cursorLine < m_firstLine || m_cursorLine >= last) {
+        m_cursorArea = utils::Boxf();
+        return;
+      }
+
+      if (m_cursorChanged || !m_cursorArea.valid()) {
+        // The text before the cursor is measured the same way as the texture
+        // of the line so that the cursor lands between the drawn characters.
+        // The cursor itself is drawn from the glyphs.
+        const float offset = measureColumn(m_cursorLine, m_cursorColumn);
+
+        const utils::Sizef sizeCursor = measureText("|", m_textRole);
+        const float top = sizeEnv.h() / 2.0f - (m_cursorLine - m_firstLine) * m_lineHeight;
+
+        m_cursorArea = utils::Boxf(
+          -sizeEnv.w() / 2.0f + offset + sizeCursor.w() / 2.0f,
+          top - sizeCursor.h() / 2.0f,
+          sizeCursor
+        );
+
+        m_cursorChanged = false;
+      }
+
+      if (m_cursorBlinkOn) {
+        drawTextOnCanvas("|", m_textRole, m_cursorArea, uuid, env, area);
+      }
+    }
+
+    bool
+    TextArea::keyPressEvent(const core::engine::KeyEvent& e) {
+      // Lock this object.
+      const std::lock_guard guard(m_propsLocker);
+
+      const bool toReturn = core::SdlWidget::keyPressEvent(e);
+
+      // Motion keys are handled even when the area is read only.
+      if (canTriggerCursorMotion(e.getRawKey())) {
+        updateCursorPosition(e.getRawKey());
+        return toReturn;
+      }
+
+      if (m_readOnly) {
+        return toReturn;
+      }
+
+      // Handle the removal of a character.
+      if (e.getRawKey() == core::engine::RawKey::BackSpace || e.getRawKey() == core::engine::RawKey::Delete) {
+        removeChar(e.getRawKey() == core::engine::RawKey::Delete);
+        return toReturn;
+      }
+
+      // Handle the creation of a new line.
+      if (e.getRawKey() == core::engine::RawKey::Return || e.getRawKey() == core::engine::RawKey::KPEnter) {
+        const std::pair<std::size_t, std::size_t> end = insertAt(m_cursorLine, m_cursorColumn, "\n");
+        updateCursorToPosition(end.first, end.second);
+
+        notifyAxis();
+
+        return toReturn;
+      }
+
+      if (!e.isPrintable()) {
+        return toReturn;
+      }
+
+      const char c = e.getChar();
+      const std::pair<std::size_t, std::size_t> end = insertAt(m_cursorLine, m_cursorColumn, std::string_view(&c, 1u));
+      updateCursorToPosition(end.first, end.second);
+
+      return toReturn;
+    }
+
+    bool
+    TextArea::keyboardGrabbedEvent(const core::engine::Event& e) {
+      // Acquire the lock on the attributes of this widget. It is released before
+      // registering to the blink timer as its callback acquires it.
+      std::unique_lock guard(m_propsLocker);
+
+      m_cursorVisible = true;
+      m_cursorBlinkOn = true;
+      m_cursorChanged = true;
+
+      requestRepaint();
+
+      const bool toReturn = core::SdlWidget::keyboardGrabbedEvent(e);
+      guard.unlock();
+
+      startBlinking();
+
+      return toReturn;
+    }
+
+    bool
+    TextArea::keyboardReleasedEvent(const core::engine::Event& e) {
+      std::unique_lock guard(m_propsLocker);
+
+      m_cursorVisible = false;
+
+      requestRepaint();
+
+      const bool toReturn = core::SdlWidget::keyboardReleasedEvent(e);
+      guard.unlock();
+
+      // The cursor is hidden: no need to blink anymore.
+      stopBlinking();
+
+      return toReturn;
+    }
+
+    bool
+    TextArea::mouseButtonReleaseEvent(const core::engine::MouseEvent& e) {
+      // Lock this object.
+      const std::lock_guard guard(m_propsLocker);
+
+      // Similarly to the textbox, the click moves the cursor to the closest
+      // character, except when the release ends a drag operation.
+      const bool toReturn = core::SdlWidget::mouseButtonReleaseEvent(e);
+
+      if (e.wasDragged() || m_lineHeight <= 0.0f) {
+        return toReturn;
+      }
+
+      utils::Vector2f localClick = mapFromGlobal(e.getMousePosition());
+      utils::Sizef size = LayoutItem::getRenderingArea().toSize();
+
+      // Lines are laid out from the top of the area.
+      const float row = std::max(0.0f, (size.h() / 2.0f - localClick.y()) / m_lineHeight);
+      const std::size_t line = std::min(m_lines.size() - 1u, m_firstLine + static_cast<std::size_t>(row));
+
+      updateCursorToPosition(line, closestColumnFrom(line, localClick.x() + size.w() / 2.0f));
+
+      return toReturn;
+    }
+
+    bool
+    TextArea::mouseWheelEvent(const core::engine::MouseEvent& e) {
+      // Only scroll when the mouse is over this area.
+      if (!isMouseInside()) {
+        return core::SdlWidget::mouseWheelEvent(e);
+      }
+
+      // Positive values correspond to scrolling towards the top of the text.
+      const int steps = -e.getScroll().y() * static_cast<int>(sk_wheelStep);
+
+      {
+        const std::lock_guard guard(m_propsLocker);
+
+        const long first = static_cast<long>(m_firstLine) + steps;
+        scrollTo(static_cast<std::size_t>(std::max(0l, first)));
+      }
+
+      return core::SdlWidget::mouseWheelEvent(e);
+    }
+
+    void
+    TextArea::build() {
+      // Only allow click and tab focus like the textbox.
+      core::FocusPolicy f(core::focus::Type::Click);
+      f.set(core::focus::Type::Tab);
+      setFocusPolicy(f);
+
+      core::engine::Palette palette = core::engine::Palette::fromButtonColor(
+        core::engine::Color::NamedColor::White
+      );
+
+      palette.setColorForRole(core::engine::Palette::ColorRole::Dark, core::engine::Color::NamedColor::White);
+
+      setPalette(palette);
+    }
+
+    void
+    TextArea::loadMetrics() {
+      loadFont();
+
+      // The glyph of the cursor gives the height of lines.
+      if (m_lineHeight <= 0.0f) {
+        m_lineHeight = measureText("|", m_textRole).h();
+        m_cursorChanged = true;
+      }
+    }
+
+    void
+    TextArea::clearTextures() {
+      for (unsigned id = 0u ; id < m_trash.size() ; ++id) {
+        getEngine().destroyTexture(m_trash[id]);
+      }
+
+      m_trash.clear();
+
+      for (unsigned id = 0u ; id < m_rendered.size() ; ++id) {
+        if (m_rendered[id] < m_lines.size() && m_lines[m_rendered[id]].texture.valid()) {
+          getEngine().destroyTexture(m_lines[m_rendered[id]].texture);
+          m_lines[m_rendered[id]].texture = utils::Uuid();
+        }
+      }
+
+      m_rendered.clear();
+    }
+
+    std::pair<std::size_t, std::size_t>
+    TextArea::insertAt(std::size_t line,
+                       std::size_t column,
+                       std::string_view text)
+    {
+      Line& current = m_lines[line];
+      releaseLine(current);
+
+      // Text without line break only modifies the current line.
+      std::size_t eol = text.find('\n');
+      if (eol == std::string_view::npos) {
+        current.text.insert(column, text);
+        return std::make_pair(line, column + text.size());
+      }
+
+      // Otherwise the end of the current line is moved after the inserted text
+      // and each line break creates a new line.
+      std::string tail = current.text.substr(column);
+      current.text.erase(column);
+      current.text.append(text.substr(0u, eol));
+
+      Lines added;
+
+      while (eol != std::string_view::npos) {
+        const std::size_t start = eol + 1u;
+        eol = text.find('\n', start);
+
+        added.push_back(Line{std::string(text.substr(start, eol - start)), utils::Uuid(), utils::Sizef()});
+      }
+
+      const std::size_t endColumn = added.back().text.size();
+      added.back().text.append(tail);
+
+      m_lines.insert(
+        m_lines.begin() + line + 1u,
+        std::make_move_iterator(added.begin()),
+        std::make_move_iterator(added.end())
+      );
+
+      shiftRenderedLines(line + 1u, static_cast<long>(added.size()));
+
+      return std::make_pair(line + added.size(), endColumn);
+    }
+
+    void
+    TextArea::removeChar(bool forward) {
+      Line& current = m_lines[m_cursorLine];
+
+      // Removing a character within a line.
+      if (forward && m_cursorColumn < current.text.size()) {
+        releaseLine(current);
+        current.text.erase(m_cursorColumn, 1u);
+
+        updateCursorToPosition(m_cursorLine, m_cursorColumn);
+        return;
+      }
+
+      if (!forward && m_cursorColumn > 0u) {
+        releaseLine(current);
+        current.text.erase(m_cursorColumn - 1u, 1u);
+
+        updateCursorToPosition(m_cursorLine, m_cursorColumn - 1u);
+        return;
+      }
+
+      // Removing a line break: the line after the break is merged into the line
+      // before it.
+      const std::size_t merged = (forward ? m_cursorLine + 1u : m_cursorLine);
+      if (merged == 0u || merged >= m_lines.size()) {
+        return;
+      }
+
+      Line& before = m_lines[merged - 1u];
+      const std::size_t column = before.text.size();
+
+      releaseLine(before);
+      releaseLine(m_lines[merged]);
+      before.text.append(m_lines[merged].text);
+
+      m_lines.erase(m_lines.begin() + merged);
+      shiftRenderedLines(merged + 1u, -1);
+
+      updateCursorToPosition(merged - 1u, column);
+
+      notifyAxis();
+    }
+
+    void
+    TextArea::updateCursorPosition(const core::engine::RawKey& k) {
+      std::size_t line = m_cursorLine;
+      std::size_t column = m_cursorColumn;
+
+      const std::size_t page = std::max(std::size_t(1u), getVisibleLinesCount());
+
+      switch (k) {
+        case core::engine::RawKey::Left:
+          if (column > 0u) {
+            --column;
+          }
+          else if (line > 0u) {
+            --line;
+            column = m_lines[line].text.size();
+          }
+          break;
+        case core::engine::RawKey::Right:
+          if (column < m_lines[line].text.size()) {
+            ++column;
+          }
+          else if (line + 1u < m_lines.size()) {
+            ++line;
+            column = 0u;
+          }
+          break;
+        case core::engine::RawKey::Up:
+          line = (line > 0u ? line - 1u : line);
+          break;
+        case core::engine::RawKey::Down:
+          ++line;
+          break;
+        case core::engine::RawKey::PageUp:
+          line = (line > page ? line - page : 0u);
+          break;
+        case core::engine::RawKey::PageDown:
+          line += page;
+          break;
+        case core::engine::RawKey::Home:
+          column = 0u;
+          break;
+        case core::engine::RawKey::End:
+          column = m_lines[line].text.size();
+          break;
+        default:
+          break;
+      }
+
+      updateCursorToPosition(line, column);
+    }
+
+    void
+    TextArea::updateCursorToPosition(std::size_t line,
+                                     std::size_t column)
+    {
+      m_cursorLine = std::min(line, m_lines.size() - 1u);
+      m_cursorColumn = std::min(column, m_lines[m_cursorLine].text.size());
+
+      // The cursor is displayed right away when it moves.
+      m_cursorChanged = true;
+      m_cursorBlinkOn = true;
+
+      // Scroll the view so that the cursor stays visible.
+      const std::size_t visible = getVisibleLinesCount();
+
+      if (m_cursorLine < m_firstLine) {
+        scrollTo(m_cursorLine);
+      }
+      else if (visible > 0u && m_cursorLine >= m_firstLine + visible) {
+        scrollTo(m_cursorLine - visible + 1u);
+      }
+
+      requestRepaint();
+    }
+
+    float
+    TextArea::measureColumn(std::size_t line,
+                            std::size_t column) const
+    {
+      const Line& l = m_lines[line];
+
+      if (column == 0u || l.text.empty()) {
+        return 0.0f;
+      }
+
+      // The whole line is as wide as its texture if it is available.
+      if (column >= l.text.size() && l.texture.valid()) {
+        return l.size.w();
+      }
+
+      return getEngine().getTextSize(l.text.substr(0u, column), m_font, false).w();
+    }
+
+    std::size_t
+    TextArea::closestColumnFrom(std::size_t line,
+                                float x) const
+    {
+      const std::string_view text = m_lines[line].text;
+
+      if (!m_font.valid() || text.empty() || x <= 0.0f) {
+        return 0u;
+      }
+
+      // The width of the prefixes of the line increases with their length: look
+      // for the first prefix which goes past the position. Prefixes are measured
+      // like the texture of the line so that clicks match the drawn characters.
+      std::size_t lower = 0u;
+      std::size_t upper = text.size();
+      float upperWidth = -1.0f;
+
+      while (lower + 1u < upper) {
+        const std::size_t mid = (lower + upper) / 2u;
+        const float w = measureColumn(line, mid);
+
+        if (w < x) {
+          lower = mid;
+        }
+        else {
+          upper = mid;
+          upperWidth = w;
+        }
+      }
+
+      if (upperWidth < 0.0f) {
+        upperWidth = measureColumn(line, upper);
+      }
+
+      if (upperWidth < x) {
+        return upper;
+      }
+
+      const float lowerWidth = measureColumn(line, lower);
+
+      return (x - lowerWidth < upperWidth - x ? lower : upper);
+    }
+
+    bool
+    TextArea::scrollTo(std::size_t first,
+                       bool notify)
+    {
+      first = std::min(first, getMaximumFirstLine());
+
+      if (first == m_firstLine) {
+        return false;
+      }
+
+      m_firstLine = first;
+      m_cursorChanged = true;
+
+      if (notify) {
+        notifyAxis();
+      }
+
+      requestRepaint();
+
+      return true;
+    }
+
+  }
+}
@@ -0,0 +1,425 @@
+#ifndef    TEXT_AREA_HH
+# define   TEXT_AREA_HH
+
+# include <mutex>
+# include <memory>
+# include <string>
+# include <vector>
+# include <utility>
+# include <string_view>
+# include <core_utils/Uuid.hh>
+# include <core_utils/Signal.hh>
+# include <sdl_core/SdlWidget.hh>
+# include "TextEditWidget.hh"
+# include "ScrollOrientation.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    class TextArea: public TextEditWidget {
+      public:
+
+        /**
+         * @brief - Creates a new multi-line text area with the specified properties.
+         *          The text area can be used to edit some text or as a viewer (for
+         *          example to follow the tail of a log) when it is set to read only.
+         *          Only the lines visible in the area are rendered: each one is kept
+         *          in its own texture until it is modified or scrolled out of view.
+         * @param name - the name of `this` text area.
+         * @param font - the name of the font to use to render the text.
+         * @param text - the initial content of the text area. Lines are separated
+         *               by `\n` characters.
+         * @param size - the size of the font to use to render the text.
+         * @param parent - a pointer to the parent widget for this text area.
+         * @param area - the size hint for this text area.
+         */
+        TextArea(const std::string& name,
+                 const std::string& font,
+                 const std::string& text = std::string(),
+                 unsigned size = 15,
+                 SdlWidget* parent = nullptr,
+                 const utils::Sizef& area = utils::Sizef());
+
+        virtual ~TextArea();
+
+        /**
+         * @brief - Replaces the whole content of the text area with the input text.
+         *          The cursor is moved to the beginning of the text.
+         * @param text - the new text to display.
+         */
+        void
+        setText(std::string_view text);
+
+        /**
+         * @brief - Appends the input text at the end of the text area. Any `\n` in
+         *          the text starts a new line. Only the last line of the existing
+         *          text is rendered again (if it is visible).
+         *          If the text area follows its tail and the last line was visible
+         *          before appending the text, the view is scrolled so that the new
+         *          last line is visible.
+         * @param text - the text to append.
+         */
+        void
+        appendText(std::string_view text);
+
+        /**
+         * @brief - Used to retrieve the whole text displayed in this text area. The
+         *          lines are separated by `\n` characters.
+         * @return - the text of this text area.
+         */
+        std::string
+        getText();
+
+        std::size_t
+        getLineCount();
+
+        /**
+         * @brief - Used to define whether the user can modify the text displayed in
+         *          this text area. A read only text area can still be scrolled.
+         * @param readOnly - `true` if the text cannot be modified.
+         */
+        void
+        setReadOnly(bool readOnly);
+
+        /**
+         * @brief - Used to define whether the view should stick to the end of the text
+         *          when some text is appended (see `appendText`).
+         * @param follow - `true` if the view should follow the end of the text.
+         */
+        void
+        setFollowTail(bool follow);
+
+        /**
+         * @brief - Used to retrieve the number of lines rendered into a texture since
+         *          the creation of this text area. This allows to check that editing
+         *          or scrolling only renders the lines which need it.
+         * @return - the number of lines rendered so far.
+         */
+        std::size_t
+        getRenderedLinesCount();
+
+        /**
+         * @brief - Used to receive the signal emitted by a scroll bar controlling the
+         *          lines displayed in this area. The semantic is the same as for the
+         *          `ScrollableWidget`: the range `[min; max]` describes the part of
+         *          the text which should be visible as a percentage of the whole text
+         *          and the vertical axis starts from the *bottom* of the text.
+         *          Horizontal scrolling is not supported: lines too long to fit in the
+         *          area are clipped.
+         * @param orientation - the orientation of the scrolling motion.
+         * @param min - the minimum value visible as defined by the control.
+         * @param max - the maximum value visible as defined by the control.
+         */
+        void
+        onControlScrolled(scroll::Orientation orientation,
+                          float min,
+                          float max);
+
+      protected:
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method in order to locate the
+         *          cursor again on the next repaint: its area depends on the size of the
+         *          widget.
+         * @param window - the available size to perform the update.
+         */
+        void
+        updatePrivate(const utils::Boxf& window) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method. The lines which are
+         *          visible are rendered if needed and drawn on the canvas. The textures
+         *          of the lines which are not visible anymore are released.
+         * @param uuid - the identifier of the canvas which we can use to draw the text.
+         * @param area - the area of the canvas to update.
+         */
+        void
+        drawContentPrivate(const utils::Uuid& uuid,
+                           const utils::Boxf& area) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to handle the edition
+         *          of the text and the motion of the cursor.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        keyPressEvent(const core::engine::KeyEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to display the cursor
+         *          and start blinking it.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        keyboardGrabbedEvent(const core::engine::Event& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to hide the cursor.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        keyboardReleasedEvent(const core::engine::Event& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to move the cursor to
+         *          the character closest to the click.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        mouseButtonReleaseEvent(const core::engine::MouseEvent& e) override;
+
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method to scroll the lines
+         *          displayed in this area.
+         * @param e - the event to be interpreted.
+         * @return - `true` if the event was recognized and `false` otherwise.
+         */
+        bool
+        mouseWheelEvent(const core::engine::MouseEvent& e) override;
+
+      private:
+
+        /**
+         * @brief - Describes a single line of text along with the texture it is rendered
+         *          into and its size. The texture is only valid while the line is visible
+         *          and is released whenever the text of the line is modified.
+         */
+        struct Line {
+          std::string text;
+          utils::Uuid texture;
+          utils::Sizef size;
+        };
+
+        using Lines = std::vector<Line>;
+
+        /**
+         * @brief - The number of lines scrolled by a single step of the mouse wheel.
+         */
+        static const unsigned sk_wheelStep;
+
+        void
+        build();
+
+        /**
+         * @brief - Loads the font if needed and computes the height of a line from the
+         *          glyph representing the cursor.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        loadMetrics();
+
+        /**
+         * @brief - Used to mark the texture of the line as released. Textures can only
+         *          be destroyed while drawing: the texture is thus only queued for the
+         *          next draw operation.
+         *          Assumes that the locker is already acquired.
+         * @param line - the line to release.
+         */
+        void
+        releaseLine(Line& line);
+
+        /**
+         * @brief - Destroys all the textures used by this text area. Should only be
+         *          called from the main thread.
+         */
+        void
+        clearTextures();
+
+        /**
+         * @brief - Used to update the indices of the lines holding a texture after some
+         *          lines have been inserted or removed. The indices greater than `from`
+         *          are moved by `delta`.
+         * @param from - the index of the first line which moved.
+         * @param delta - the number of lines inserted (if positive) or removed.
+         */
+        void
+        shiftRenderedLines(std::size_t from,
+                           long delta);
+
+        /**
+         * @brief - Used to compute the number of lines which can be fully displayed in
+         *          the area of this widget. Returns `0` until the font is loaded.
+         * @return - the number of visible lines.
+         */
+        std::size_t
+        getVisibleLinesCount() const noexcept;
+
+        /**
+         * @brief - Used to compute the index of the first line displayed when the view
+         *          is scrolled to the end of the text.
+         * @return - the largest admissible index for the first visible line.
+         */
+        std::size_t
+        getMaximumFirstLine() const noexcept;
+
+        /**
+         * @brief - Inserts the input text at the specified position. Any `\n` in the
+         *          text splits the line. Only the line where the text is inserted is
+         *          released: new lines are rendered when they become visible.
+         *          Assumes that the locker is already acquired.
+         * @param line - the index of the line where the text is inserted.
+         * @param column - the position in the line where the text is inserted.
+         * @param text - the text to insert.
+         * @return - the line and column right after the inserted text.
+         */
+        std::pair<std::size_t, std::size_t>
+        insertAt(std::size_t line,
+                 std::size_t column,
+                 std::string_view text);
+
+        /**
+         * @brief - Removes the character in front of the cursor or behind it. Removing
+         *          the end of a line merges it with the next one.
+         *          Assumes that the locker is already acquired.
+         * @param forward - `true` if the character in front of the cursor is removed.
+         */
+        void
+        removeChar(bool forward);
+
+        /**
+         * @brief - Used to determine whether the input key moves the cursor.
+         * @param k - the key to check.
+         * @return - `true` if the key moves the cursor.
+         */
+        bool
+        canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept;
+
+        /**
+         * @brief - Moves the cursor according to the input key.
+         *          Assumes that the locker is already acquired.
+         * @param k - the key describing the motion.
+         */
+        void
+        updateCursorPosition(const core::engine::RawKey& k);
+
+        /**
+         * @brief - Moves the cursor to the specified position and scrolls the view so
+         *          that it stays visible. The position is clamped to the text.
+         *          Assumes that the locker is already acquired.
+         * @param line - the line of the cursor.
+         * @param column - the position of the cursor in the line.
+         */
+        void
+        updateCursorToPosition(std::size_t line,
+                               std::size_t column);
+
+        /**
+         * @brief - Used to compute the width of the first `column` characters of the line.
+         *          The text is measured by the engine with the font used to render the
+         *          texture of the line so that the result is consistent with the drawn
+         *          line (which accounts for kerning, unlike a sum of glyph advances).
+         *          Assumes that the locker is already acquired and that the font is loaded.
+         * @param line - the index of the line.
+         * @param column - the number of characters to measure.
+         * @return - the width of the first `column` characters of the line.
+         */
+        float
+        measureColumn(std::size_t line,
+                      std::size_t column) const;
+
+        /**
+         * @brief - Used to compute the column in the line closest to the input abscissa
+         *          expressed relatively to the left of the line.
+         *          Assumes that the locker is already acquired.
+         * @param line - the index of the line.
+         * @param x - the abscissa to look for.
+         * @return - the column closest to `x`.
+         */
+        std::size_t
+        closestColumnFrom(std::size_t line,
+                          float x) const;
+
+        /**
+         * @brief - Scrolls the view so that the `first` line is displayed at the top of
+         *          the area. The value is clamped so that the view does not go past the
+         *          end of the text.
+         *          Assumes that the locker is already acquired.
+         * @param first - the index of the line to display at the top.
+         * @param notify - `true` if the `onVerticalAxisChanged` signal should be emitted.
+         * @return - `true` if the view was modified.
+         */
+        bool
+        scrollTo(std::size_t first,
+                 bool notify = true);
+
+        /**
+         * @brief - Notifies listeners of the `onVerticalAxisChanged` signal with the part
+         *          of the text currently visible.
+         *          Assumes that the locker is already acquired.
+         */
+        void
+        notifyAxis();
+
+      private:
+
+        /**
+         * @brief - The index of lines of the text. Each line holds its own texture so that
+         *          modifying a line only renders this line again.
+         */
+        Lines m_lines;
+
+        /**
+         * @brief - The indices of the lines currently holding a texture. This is kept up
+         *          to date when lines are inserted or removed so that the textures can be
+         *          released when lines are scrolled out of the view.
+         */
+        std::vector<std::size_t> m_rendered;
+
+        /**
+         * @brief - Textures which are not used anymore and should be destroyed on the
+         *          next draw operation.
+         */
+        std::vector<utils::Uuid> m_trash;
+
+        /**
+         * @brief - The index of the first line displayed at the top of the area.
+         */
+        std::size_t m_firstLine;
+
+        /**
+         * @brief - The position of the cursor: the line and the index of the character
+         *          right after the cursor in this line.
+         */
+        std::size_t m_cursorLine;
+        std::size_t m_cursorColumn;
+
+        /**
+         * @brief - Used to determine whether the position of the cursor should be computed
+         *          again. It is kept in `m_cursorArea` (in local coordinates) so that the
+         *          blinking only repaints the cursor.
+         */
+        bool m_cursorChanged;
+
+        bool m_readOnly;
+        bool m_followTail;
+
+        /**
+         * @brief - The height of a line, deduced from the glyph of the cursor.
+         */
+        float m_lineHeight;
+
+        core::engine::Palette::ColorRole m_textRole;
+
+        std::size_t m_renderedLines;
+
+      public:
+
+        /**
+         * @brief - Signal emitted whenever the lines displayed in this area change. The
+         *          values describe the visible part of the text as a percentage of the
+         *          whole text, starting from the *bottom* (see `onControlScrolled`).
+         */
+        utils::Signal<float, float> onVerticalAxisChanged;
+    };
+
+    using TextAreaShPtr = std::shared_ptr<TextArea>;
+  }
+}
+
+# include "TextArea.hxx"
+
+#endif    /* TEXT_AREA_HH */
@@ -0,0 +1,128 @@
+#ifndef    TEXT_AREA_HXX
+# define   TEXT_AREA_HXX
+
+# include "TextArea.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    std::string
+    TextArea::getText() {
+      const std::lock_guard guard(m_propsLocker);
+
+      std::string text;
+      for (Lines::const_iterator it = m_lines.cbegin() ; it != m_lines.cend() ; ++it) {
+        if (it != m_lines.cbegin()) {
+          text += '\n';
+        }
+        text += it->text;
+      }
+
+      return text;
+    }
+
+    inline
+    std::size_t
+    TextArea::getLineCount() {
+      const std::lock_guard guard(m_propsLocker);
+      return m_lines.size();
+    }
+
+    inline
+    void
+    TextArea::setReadOnly(bool readOnly) {
+      const std::lock_guard guard(m_propsLocker);
+      m_readOnly = readOnly;
+    }
+
+    inline
+    void
+    TextArea::setFollowTail(bool follow) {
+      const std::lock_guard guard(m_propsLocker);
+      m_followTail = follow;
+    }
+
+    inline
+    std::size_t
+    TextArea::getRenderedLinesCount() {
+      const std::lock_guard guard(m_propsLocker);
+      return m_renderedLines;
+    }
+
+    inline
+    void
+    TextArea::releaseLine(Line& line) {
+      if (line.texture.valid()) {
+        m_trash.push_back(line.texture);
+        line.texture = utils::Uuid();
+      }
+    }
+
+    inline
+    void
+    TextArea::shiftRenderedLines(std::size_t from,
+                                 long delta)
+    {
+      for (unsigned id = 0u ; id < m_rendered.size() ; ++id) {
+        if (m_rendered[id] >= from) {
+          m_rendered[id] = static_cast<std::size_t>(static_cast<long>(m_rendered[id]) + delta);
+        }
+      }
+    }
+
+    inline
+    std::size_t
+    TextArea::getVisibleLinesCount() const noexcept {
+      if (m_lineHeight <= 0.0f) {
+        return 0u;
+      }
+
+      const float height = LayoutItem::getRenderingArea().h();
+
+      return std::max(std::size_t(1u), static_cast<std::size_t>(height / m_lineHeight));
+    }
+
+    inline
+    std::size_t
+    TextArea::getMaximumFirstLine() const noexcept {
+      const std::size_t visible = getVisibleLinesCount();
+      return (m_lines.size() > visible ? m_lines.size() - visible : 0u);
+    }
+
+    inline
+    bool
+    TextArea::canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept {
+      return
+        k == core::engine::RawKey::Left ||
+        k == core::engine::RawKey::Right ||
+        k == core::engine::RawKey::Up ||
+        k == core::engine::RawKey::Down ||
+        k == core::engine::RawKey::Home ||
+        k == core::engine::RawKey::End ||
+        k == core::engine::RawKey::PageUp ||
+        k == core::engine::RawKey::PageDown
+      ;
+    }
+
+    inline
+    void
+    TextArea::notifyAxis() {
+      // Express the visible lines as a percentage of the text, starting from
+      // the bottom as for scrollable widgets.
+      const float count = 1.0f * m_lines.size();
+      const std::size_t visible = std::min(getVisibleLinesCount(), m_lines.size() - m_firstLine);
+
+      const float top = 1.0f - m_firstLine / count;
+      const float bottom = 1.0f - (m_firstLine + visible) / count;
+
+      onVerticalAxisChanged.safeEmit(
+        std::string("onVerticalAxisChanged::emit([") + std::to_string(bottom) + " - " + std::to_string(top) + "])",
+        bottom, top
+      );
+    }
+
+  }
+}
+
+#endif    /* TEXT_AREA_HXX */
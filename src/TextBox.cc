@@ -4,38 +4,38 @@
 namespace sdl {
   namespace graphic {
 
+    const std::chrono::milliseconds TextBox::sk_defaultDebounceDelay(300);
+
     TextBox::TextBox(const std::string& name,
                      const std::string& font,
                      const std::string& text,
                      unsigned size,
                      SdlWidget* parent,
                      const utils::Sizef& area):
-      core::SdlWidget(name, area, parent),
+      TextEditWidget(name, font, size, parent, area),
       m_text(text),
       m_cursorIndex(0u),
-      m_cursorVisible(false),
       m_cursorChanged(true),
 
       m_selectionStart(m_cursorIndex),
       m_selectionStarted(false),
 
-      m_fontName(font),
-      m_fontSize(size),
-      m_font(),
-
       m_textRole(core::engine::Palette::ColorRole::WindowText),
 
       m_textChanged(true),
 
-      m_leftText(),
-      m_cursor(),
-      m_rightText(),
+      m_cursorRole(m_textRole),
 
       m_selectionBackground(),
 
-      m_propsLocker(),
-
       m_validator(nullptr),
+      m_validation(nullptr),
+
+      m_notificationMode(NotificationMode::OnCommit),
+      m_debounceDelay(sk_defaultDebounceDelay),
+      m_notificationPending(false),
+      m_lastEdit(),
+      m_suppressedNotifications(0u),
 
       onValueChanged()
     {
@@ -44,16 +44,14 @@ namespace sdl {
     }
 
     TextBox::~TextBox() {
+      // Stop blinking and waiting for the debounce delay: no callback can be
+      // issued on this textbox afterwards. This should happen before anything
+      // is destroyed as the callbacks access the attributes of the textbox.
+      stopBlinking();
+      DebounceTimer::getInstance().cancel(this);
+
       // Clear text.
       clearText();
-
-      // Clear cursor.
-      clearCursor();
-
-      // Clear font.
-      if (m_font.valid()) {
-        getEngine().destroyColoredFont(m_font);
-      }
     }
 
     bool
@@ -317,8 +315,9 @@ namespace sdl {
       utils::Boxf env = utils::Boxf::fromSize(sizeEnv, true);
 
       // Render the left part of the text if it is valid.
-      if (m_leftText.valid() && hasLeftTextPart()) {
-        drawPartOnCanvas(m_leftText, computeLeftTextPosition(sizeEnv), uuid, env, area);
+      if (hasLeftTextPart()) {
+        const utils::Boxf dst = computeLeftTextPosition(sizeEnv);
+        drawTextOnCanvas(getLeftText(), m_textRole, dst, uuid, env, area);
       }
 
       // Render the selected part of the text if it is valid.
@@ -327,18 +326,27 @@ namespace sdl {
       }
 
       // Render the selected part of the text if it is valid.
-      if (m_selectedText.valid() && hasSelectedTextPart()) {
-        drawPartOnCanvas(m_selectedText, computeSelectedTextPosition(sizeEnv), uuid, env, area);
+      if (hasSelectedTextPart()) {
+        const utils::Boxf dst = computeSelectedTextPosition(sizeEnv);
+        drawTextOnCanvas(getSelectedText(), core::engine::Palette::ColorRole::HighlightedText, dst, uuid, env, area);
       }
 
-      // Render the cursor if needed (i.e. if the keyboard focus is active).
-      if (m_cursor.valid() && isCursorVisible()) {
-        drawPartOnCanvas(m_cursor, computeCursorPosition(sizeEnv), uuid, env, area);
+      // Render the cursor if needed (i.e. if the keyboard focus is active). Its
+      // area is kept so that blinking only repaints this part of the textbox.
+      m_cursorArea = utils::Boxf();
+
+      if (m_font.valid() && isCursorVisible()) {
+        m_cursorArea = computeCursorPosition(sizeEnv);
+
+        if (m_cursorBlinkOn) {
+          drawTextOnCanvas("|", m_cursorRole, m_cursorArea, uuid, env, area);
+        }
       }
 
       // Render the right part of the text if it is valid.
-      if (m_rightText.valid() && hasRightTextPart()) {
-        drawPartOnCanvas(m_rightText, computeRightTextPosition(sizeEnv), uuid, env, area);
+      if (hasRightTextPart()) {
+        const utils::Boxf dst = computeRightTextPosition(sizeEnv);
+        drawTextOnCanvas(getRightText(), m_textRole, dst, uuid, env, area);
       }
     }
 
@@ -433,7 +441,16 @@ namespace sdl {
       }
 
       // Erase the corresponding character.
-      m_text.erase(m_text.begin() + toRemoveBegin, m_text.begin() + toRemoveEnd);
+      m_text.erase(toRemoveBegin, toRemoveEnd);
+
+      validateEdit(
+        Validator::Edit{
+          Validator::EditType::Removal,
+          toRemoveBegin,
+          toRemoveEnd - toRemoveBegin,
+          std::string_view()
+        }
+      );
 
       // Now we need to update the cursor position so that it stays at the same
       // position no matter the deletion.
@@ -456,6 +473,7 @@ namespace sdl {
 
       // Also we need to trigger a repaint as the text has changed.
       setTextChanged();
+      markValueChanged();
     }
 
     unsigned
@@ -465,10 +483,10 @@ namespace sdl {
       //    the input `pos`.
       //  - any string larger than the one terminating at this character has its
       //    last character completely beyond the input `pos`.
-      // In order to determine this index, we will use the dedicated `SDL TTF API`
-      // method which allows to compute the dimension of a string as if it was
-      // rendered for display. We will loop through the text displayed in this box
-      // and pick the character fitting the above conditions.
+      // In order to determine this index, we will accumulate the advances of the
+      // glyphs used to display the text: this gives the dimension of each prefix
+      // of the string as it is rendered. We will loop through the text displayed
+      // in this box and pick the character fitting the above conditions.
       // Note that to provide the most exact detection of the character we actually
       // account for intra-character selection, meaning that if the user clicks on
       // the left half of a character, the cursor will be positionned before this
@@ -484,17 +502,22 @@ namespace sdl {
       // Start at the beginning of the text displayed in this box.
       unsigned id = 0u;
       bool valid = false;
-      utils::Sizef textSize;
+      float width = 0.0f;
+      float widthWithoutLast = 0.0f;
 
       utils::Sizef area = core::LayoutItem::getRenderingArea().toSize();
 
       while (!valid && id <= m_text.size()) {
-        // Render the string containing the characters until `id` and check whether
-        // the click is now on the left side of the rendered string.
-        textSize = getEngine().getTextSize(m_text.substr(0u, id), m_font, false);
+        // Compute the width of the string containing the characters until `id` by
+        // adding the advance of the last character and check whether the click is
+        // now on the left side of the rendered string.
+        if (id > 0u) {
+          widthWithoutLast = width;
+          width += measureText(m_text.view(id - 1u, 1u), m_textRole).w();
+        }
 
         // Check whether the size of the text is now encompassing the input position.
-        if (-area.w() / 2.0f + textSize.w() >= pos.x()) {
+        if (-area.w() / 2.0f + width >= pos.x()) {
           // We found the character we wanted.
           valid = true;
         }
@@ -524,10 +547,8 @@ namespace sdl {
         return id;
       }
 
-      utils::Sizef sizeWithoutLast = getEngine().getTextSize(m_text.substr(0u, id - 1), m_font, false);
-
-      const float delta = textSize.w() - sizeWithoutLast.w();
-      const float offset = pos.x() + area.w() / 2.0f - sizeWithoutLast.w();
+      const float delta = width - widthWithoutLast;
+      const float offset = pos.x() + area.w() / 2.0f - widthWithoutLast;
 
       if (offset <= delta / 2.0f) {
         --id;
@@ -542,15 +563,7 @@ namespace sdl {
       // The left part of the text is always on the left part of the widget. It cannot
       // be offseted by the cursor because the whole point of the `left part` of the
       // text is to be on the left of the cursor.
-      // We assume that this method should not be called if the `m_leftText` texture is
-      // not valid, otherwise we're not able to compute a valid position.
-      if (!m_leftText.valid()) {
-        error(
-          std::string("Could not compute position of the left part of the text in textbox"),
-          std::string("Invalid text texture")
-        );
-      }
-      utils::Sizef sizeLeft = getEngine().queryTexture(m_leftText);
+      utils::Sizef sizeLeft = measureText(getLeftText(), m_textRole);
 
       return utils::Boxf(
         -env.w() / 2.0f + sizeLeft.w() / 2.0f,
@@ -567,18 +580,12 @@ namespace sdl {
 
       // Retrieve the size of the left part of the text if any.
       utils::Sizef sizeLeft;
-      if (m_leftText.valid()) {
-        sizeLeft = getEngine().queryTexture(m_leftText);
+      if (hasLeftTextPart()) {
+        sizeLeft = measureText(getLeftText(), m_textRole);
       }
 
       // Retrieve the size of the selected text.
-      if (!m_selectedText.valid()) {
-        error(
-          std::string("Could not compute position of the selected part of the text in textbox"),
-          std::string("Invalid text texture")
-        );
-      }
-      utils::Sizef sizeSelected = getEngine().queryTexture(m_selectedText);
+      utils::Sizef sizeSelected = measureText(getSelectedText(), core::engine::Palette::ColorRole::HighlightedText);
 
       return utils::Boxf(
         -env.w() / 2.0f + sizeLeft.w() + sizeSelected.w() / 2.0f,
@@ -590,18 +597,10 @@ namespace sdl {
     utils::Boxf
     TextBox::computeCursorPosition(const utils::Sizef& env) const noexcept {
       // The cursor should be placed at the location specified by the `m_cursorIndex`.
-      // In order to determine the position we have to rely on the engine method allowing
-      // to determine the length of a rendered text: this will allow to precisely position
-      // the cursor after the targeted character.
-      // We assume that the cursor is visible when calling this method. We also verify
-      // that the associated texture is valid because we have to use its dimensions to
-      // position it accurately.
-      if (!m_cursor.valid()) {
-        error(
-          std::string("Could not compute cursor position in textbox"),
-          std::string("Invalid cursor texture")
-        );
-      }
+      // In order to determine the position we rely on the advances of the glyphs used
+      // to draw the text: this will allow to precisely position the cursor after the
+      // targeted character.
+      // We assume that the cursor is visible when calling this method.
       if (!isCursorVisible()) {
         error(
           std::string("Could not compute cursor position in textbox"),
@@ -615,12 +614,12 @@ namespace sdl {
         );
       }
 
-      // Query the size of the text up to the `m_cursorIndex`-nth character: this will
-      // provide an offset to localize the cursor's texture on this textbox.
-      utils::Sizef text = getEngine().getTextSize(m_text.substr(0u, m_cursorIndex), m_font, false);
+      // Measure the text up to the `m_cursorIndex`-nth character: this will provide
+      // an offset to localize the cursor on this textbox.
+      utils::Sizef text = measureText(m_text.view(0u, m_cursorIndex), m_textRole);
 
       // The cursor should be positionned right after that.
-      utils::Sizef sizeCursor = getEngine().getTextSize("|", m_font, true);
+      utils::Sizef sizeCursor = measureText("|", m_cursorRole);
 
       return utils::Boxf(
         -env.w() / 2.0f + text.w() + sizeCursor.w() / 2.0f,
@@ -637,57 +636,21 @@ namespace sdl {
 
       // Retrieve the size of the left part if any.
       utils::Sizef sizeLeft;
-      if (m_leftText.valid()) {
-        sizeLeft = getEngine().queryTexture(m_leftText);
+      if (hasLeftTextPart()) {
+        sizeLeft = measureText(getLeftText(), m_textRole);
       }
 
       // Retrieve the size of the selected part if any.
       utils::Sizef sizeSelected;
-      if (m_selectedText.valid()) {
-        sizeSelected = getEngine().queryTexture(m_selectedText);
+      if (hasSelectedTextPart()) {
+        sizeSelected = measureText(getSelectedText(), core::engine::Palette::ColorRole::HighlightedText);
       }
 
-      // It is also a problem if the right part is not valid.
-      if (!m_rightText.valid()) {
-        error(
-          std::string("Could not compute position of the right part of the text in textbox"),
-          std::string("Invalid text texture")
-        );
-      }
-      utils::Sizef sizeRight = getEngine().queryTexture(m_rightText);
+      utils::Sizef sizeRight = measureText(getRightText(), m_textRole);
 
       // Locate the right part of the text after the left and cursor part.
       return utils::Boxf(-env.w() / 2.0f + sizeLeft.w() + sizeSelected.w() + sizeRight.w() / 2.0f, 0.0f, sizeRight);
     }
 
-    void
-    TextBox::drawPartOnCanvas(const utils::Uuid& uuid,
-                              const utils::Boxf& localDst,
-                              const utils::Uuid& canvas,
-                              const utils::Boxf& env,
-                              const utils::Boxf& toUpdate)
-    {
-      // Determine whether some part of the input `uuid` texture are spanned by the
-      // area to update.
-      utils::Boxf dstRectToUpdate = localDst.intersect(toUpdate);
-
-      if (dstRectToUpdate.valid()) {
-        // Some portion of the `uuid` should be repainted as it matches the area to
-        // update. Retrieve the dimensions of the `uuid` texture.
-        utils::Sizef sizeText = getEngine().queryTexture(uuid);
-
-        // Convert the area which should be repaint to the local `uuid` coordinate
-        // frame: indeed the `dstRectToUpdate` is expressed in the parent's frame.
-        utils::Boxf srcRect = convertToLocal(dstRectToUpdate, localDst);
-
-        // Convert both the source and destination areas to engine format.
-        utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, sizeText);
-        utils::Boxf dstRectEngine = convertToEngineFormat(dstRectToUpdate, env);
-
-        // Draw the `uuid` onto the `canvas` at last.
-        getEngine().drawTexture(uuid, &srcRectEngine, &canvas, &dstRectEngine);
-      }
-    }
-
   }
 }
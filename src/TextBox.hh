@@ -1,19 +1,39 @@
 #ifndef    TEXT_BOX_HH
 # define   TEXT_BOX_HH
 
+# include <chrono>
 # include <memory>
 # include <string>
+# include <string_view>
 # include <core_utils/Uuid.hh>
 # include <core_utils/Signal.hh>
 # include <sdl_core/SdlWidget.hh>
 # include "Validator.hh"
+# include "GapBuffer.hh"
+# include "TextEditWidget.hh"
+# include "DebounceTimer.hh"
 
 namespace sdl {
   namespace graphic {
 
-    class TextBox: public core::SdlWidget {
+    class TextBox: public TextEditWidget {
       public:
 
+        /**
+         * @brief - Describes when the `onValueChanged` signal is emitted as the user edits
+         *          the text. Whatever the mode, pressing one of the `Return` keys always
+         *          emits the signal.
+         *          Except for `Immediate`, edits are not validated as the user types: the
+         *          validation and fixup only happen when the value is notified and edits
+         *          happening in between are gathered into a single notification.
+         */
+        enum class NotificationMode {
+          Immediate,  //<!- After each key release which modified the text.
+          Debounced,  //<!- Once the text has not been modified for a given delay.
+          OnCommit,   //<!- When a `Return` key is pressed or the textbox loses the focus.
+          PerFrame    //<!- At most once per repaint of the textbox.
+        };
+
         /**
          * @brief - Creates a new textbox with the specified properties. The user can
          *          specify the name of this textbox along with the initial text that
@@ -66,6 +86,39 @@ namespace sdl {
         void
         setValue(const std::string& value);
 
+        /**
+         * @brief - Used to define when the `onValueChanged` signal is emitted while the
+         *          user edits the text. Any pending notification is kept and delivered
+         *          according to the new mode.
+         * @param mode - the new notification mode.
+         * @param delay - the duration without edits after which the value is notified
+         *                in `Debounced` mode. Ignored in any other mode.
+         */
+        void
+        setNotificationMode(const NotificationMode& mode,
+                            std::chrono::milliseconds delay = sk_defaultDebounceDelay);
+
+        /**
+         * @brief - Used to retrieve the number of notifications which were not emitted
+         *          since the textbox was created because edits were gathered together
+         *          by the notification mode. This is the number of additional signals
+         *          which would have been emitted in `Immediate` mode.
+         * @return - the number of suppressed notifications.
+         */
+        std::size_t
+        getSuppressedNotificationsCount() noexcept;
+
+        /**
+         * @brief - Used to retrieve the statistics of the cache used to render and
+         *          measure the text of this textbox. This allows to check how often
+         *          the position of the cursor or of the selection is computed again
+         *          from the glyphs. Note that the cache is shared with the widgets
+         *          using the same font.
+         * @return - the statistics of the text cache.
+         */
+        GlyphCache::Stats
+        getTextCacheStats() noexcept;
+
       protected:
 
         /**
@@ -145,6 +198,17 @@ namespace sdl {
         bool
         mouseDragEvent(const core::engine::MouseEvent& e) override;
 
+        /**
+         * @brief - Reimplementation of the base `SdlWidget` method in order to notify the
+         *          edits gathered since the last repaint in `PerFrame` mode, and the ones
+         *          for which the delay expired in `Debounced` mode: the `DebounceTimer`
+         *          requests a repaint once this happens.
+         * @param e - the paint event to process.
+         * @return - `true` if the event was recognized, `false` otherwise.
+         */
+        bool
+        repaintEvent(const core::engine::PaintEvent& e) override;
+
         /**
          * @brief - Reimplementation of the base `SdlWidget` method. A texture representing
          *          the text associated to this textbox along with a visual representation of
@@ -181,6 +245,16 @@ namespace sdl {
           ToEnd
         };
 
+        /**
+         * @brief - Describes the events which can lead to emitting a pending notification
+         *          of the value of the textbox.
+         */
+        enum class NotificationTrigger {
+          KeyRelease, //<!- A key has been released while editing the text.
+          Repaint,    //<!- A repaint event is processed by the textbox.
+          Commit      //<!- The user validated the value or left the textbox.
+        };
+
         /**
          * @brief - Used internally upon constructing the text box to initialize internal
          *          states.
@@ -260,6 +334,55 @@ namespace sdl {
         void
         removeCharFromText(bool forward);
 
+        /**
+         * @brief - Used to update the validation state of the text after the input `edit`
+         *          has been applied to it. The validator is given the edit so that it can
+         *          update its verdict without going through the whole text if possible.
+         *          A message is logged whenever the state of the text changes.
+         *          Nothing happens if no validator is assigned to this textbox.
+         * @param edit - the modification applied to the internal text.
+         */
+        void
+        validateEdit(const Validator::Edit& edit);
+
+        /**
+         * @brief - Used to register that the text has been edited by the user and that
+         *          the listeners should be notified of its new value. In case a value
+         *          was already waiting to be notified the edit is merged with it and
+         *          counted as a suppressed notification.
+         *          Assumes that the `m_propsLocker` is already locked.
+         */
+        void
+        markValueChanged();
+
+        /**
+         * @brief - Used to schedule the notification of the pending edits once the delay
+         *          of the `Debounced` mode expires. The `DebounceTimer` requests a repaint
+         *          at this point, which is when the notification is emitted. Nothing
+         *          happens in any other mode.
+         *          Assumes that the `m_propsLocker` is already locked.
+         */
+        void
+        scheduleNotification();
+
+        /**
+         * @brief - Used to determine whether the pending notification (if any) should be
+         *          emitted given the notification mode and the event being processed. If
+         *          this is the case the notification is considered handled.
+         *          Assumes that the `m_propsLocker` is already locked.
+         * @param trigger - the event currently processed.
+         * @return - `true` if the value should be notified.
+         */
+        bool
+        consumePendingNotification(const NotificationTrigger& trigger);
+
+        /**
+         * @brief - Retrieves the value of the textbox and emits it through the signal
+         *          `onValueChanged`. Assumes that the `m_propsLocker` is NOT locked.
+         */
+        void
+        notifyValue();
+
         /**
          * @brief - Used to start a selection from the internal position of the cursor. This will
          *          set the `m_selectionStarted` boolean to `true` and register the current cursor's
@@ -280,42 +403,30 @@ namespace sdl {
         stopSelection() noexcept;
 
         /**
-         * @brief - Used to perform the loading of the font to use to render the text.
-         */
-        void
-        loadFont();
-
-        /**
-         * @brief - Used to perform the loading of the text into the various textures used to
-         *          represent the text. This method handles the loading of the font if needed
-         *          and the recreation of the texture representing the text if needed.
+         * @brief - Used to prepare the rendering of the text. This method handles the loading
+         *          of the font if needed and the creation of the background of the selected
+         *          part of the text. The text itself is drawn from glyphs and thus does not
+         *          need to be rendered here.
          */
         void
         loadText();
 
         /**
-         * @brief - Used to perform the loading of the cursor into the `m_cursor` texture. This
-         *          method handles the loading of the font if needed even though we should hardly
-         *          ever need it in this function because the `loadText` method should handle it.
+         * @brief - Used to prepare the rendering of the cursor, which is drawn as a glyph. The
+         *          font is loaded if needed and the role of the glyph is updated to contrast
+         *          with what lies behind the cursor.
          */
         void
         loadCursor();
 
         /**
-         * @brief - Destroys the texture contained in the various textures used to represent the
-         *          text in thie box. Invalidate each one of them when the clearing is done.
-         *          Should typically be used when recreating the text after a modification of
-         *          the rendering mode.
+         * @brief - Destroys the texture used as background for the selected text and
+         *          invalidates it. Should typically be used when recreating the text
+         *          after a modification of the rendering mode.
          */
         void
         clearText();
 
-        /**
-         * @brief - Destroys the texture contained in the `m_cursor` and invalidates it.
-         */
-        void
-        clearCursor();
-
         /**
          * @brief - Used to determine whether the cursor is visible. This is a convenience wrapper
          *          around the internal `m_cursorVisible` attribute to allow for easy modification
@@ -348,10 +459,11 @@ namespace sdl {
          *          text based on the internal cursor's position and text.
          *          Note that if `hasLeftTextPart` returns `false` the returned string will
          *          be empty.
-         * @return - a string representing the part of the internal `m_text` which is assigned
-         *           to the left part of the text. Can be empty.
+         * @return - a view on the part of the internal `m_text` which is assigned to the
+         *           left part of the text. Can be empty. The view is only valid until the
+         *           text is accessed again.
          */
-        std::string
+        std::string_view
         getLeftText() const noexcept;
 
         /**
@@ -369,10 +481,11 @@ namespace sdl {
          *          based on the internal cursor's position and text.
          *          Note that if `hasSelectedTextPart` returns `false` the returned string will
          *          be empty.
-         * @return - a string representing the part of the internal `m_text` which is assigned
-         *           to the selected part of the text. Can be empty.
+         * @return - a view on the part of the internal `m_text` which is assigned to the
+         *           selected part of the text. Can be empty. The view is only valid until
+         *           the text is accessed again.
          */
-        std::string
+        std::string_view
         getSelectedText() const noexcept;
 
         /**
@@ -390,10 +503,11 @@ namespace sdl {
          *          based on the internal cursor's position and text.
          *          Note that if `hasRightTextPart` returns `false` the returned string will
          *          be empty.
-         * @return - a string representing the part of the internal `m_text` which is assigned
-         *           to the right part of the text. Can be empty.
+         * @return - a view on the part of the internal `m_text` which is assigned to the
+         *           right part of the text. Can be empty. The view is only valid until the
+         *           text is accessed again.
          */
-        std::string
+        std::string_view
         getRightText() const noexcept;
 
         /**
@@ -524,28 +638,6 @@ namespace sdl {
         utils::Boxf
         computeRightTextPosition(const utils::Sizef& env) const noexcept;
 
-        /**
-         * @brief - Used to perform the drawing of the portion of the texture described by `uuid` to
-         *          the specified `canvas`. In order to determine which portion of the `uuid` should
-         *          be repainted we use the `toUpdate` which represents an area expressed in parent's
-         *          coordinate frame of the area to update. The `localDst` represents the area in
-         *          parent's coordinate frame covered by the `uuid` texture.
-         *          By computing the intersection of both this method is able to derive and repaint
-         *          only the relevant part of the `uuid` (if any) to the provided `canvas` texture.
-         * @param uuid - The texture to repaint. We assume that this texture is valid.
-         * @param localDst - the area covered by the `uuid` texture in parent coordinate frame.
-         * @param canvas - the identifier of the texture onto which the `uuid` should be repainted.
-         * @param env - a description of the size of the environment (i.e. the `canvas` texture) which
-         *              is used to perform conversion of various areas in engine format.
-         * @param toUpdate - an area representing the area to update in parent's coordinate frame.
-         */
-        void
-        drawPartOnCanvas(const utils::Uuid& uuid,
-                         const utils::Boxf& localDst,
-                         const utils::Uuid& canvas,
-                         const utils::Boxf& env,
-                         const utils::Boxf& toUpdate);
-
       private:
 
         /**
@@ -556,8 +648,10 @@ namespace sdl {
          *          A modification of any of the properties or of the text itself triggers a
          *          repaint operation which will recreate the text's texture. Such operations
          *          are thus to be handled with care.
+         *          The text is stored in a gap buffer so that edits around the cursor do
+         *          not depend on the length of the text.
          */
-        std::string m_text;
+        GapBuffer m_text;
 
         /**
          * @brief - Indicates the current position of the cursor. The position indicates the
@@ -569,19 +663,10 @@ namespace sdl {
         unsigned m_cursorIndex;
 
         /**
-         * @brief - Indicates whether the cursor is visible. We display the cursor only when
-         *          this textbox has keyboard focus, which is likely to indicate that the user
-         *          is ready to make some modifications on the internal text. The cursor is a
-         *          visual aid to indicate which character will be affected by the next update
-         *          to the textbox.
-         */
-        bool m_cursorVisible;
-
-        /**
-         * @brief - Used to determine whether the texture cached in `m_cursor` is valid and can
-         *          be reused as is or if it should be recreated. Typical case where this value
-         *          is set to `true` is when the cursor becomes visible or when its color should
-         *          be updated as a result of a selection operation.
+         * @brief - Used to determine whether the role of the cursor is up to date or if it
+         *          should be computed again. Typical case where this value is set to `true`
+         *          is when the cursor becomes visible or when its color should be updated as
+         *          a result of a selection operation.
          */
         bool m_cursorChanged;
 
@@ -602,20 +687,6 @@ namespace sdl {
          */
         bool m_selectionStarted;
 
-        /**
-         * @brief - Information about the font to use to render the text. We use the `m_fontName`
-         *          and `m_fontSize` to store information while the font is not loaded yet. The
-         *          `m_font` itself holds an identifier returned by the engine which allows to
-         *          access to the font's data through the engine.
-         *          The information contained in these arguments may mismatch if the `m_textChanged`
-         *          boolean is set to `true`. Upon the next repaint operation it should be corrected
-         *          and if `m_textChanged` is `false` all these attributes should represent the
-         *          same font.
-         */
-        std::string m_fontName;
-        unsigned m_fontSize;
-        utils::Uuid m_font;
-
         /**
          * @brief - Describes the role of the text's texture to use. Various roles usually implies
          *          different colors. This role is used so that the highlight operation of the base
@@ -636,28 +707,10 @@ namespace sdl {
         bool m_textChanged;
 
         /**
-         * @brief - Used to perform some caching of the data for this textbox. In order to account for
-         *          the possible positions of the cursor when editing the text of the text box we need
-         *          four separate textures to represent the text:
-         *            - a texture to represent the text on the left of the cursor
-         *            - a texture to represent the cursor itself
-         *            - a texture to represent the text on the right of the cursor
-         *            - a texture to represent the text currently selected
-         * Not all of them are always valid, and the caching only holds until a character is added to
-         * the text of this box or until the cursor is moved.
-         * These values are also invalidated whenever the font or the text size is modified.
-         * Note that unless the `m_textChanged` is set to `true` the content of these textures can be
-         * used without modifications.
-         * A general rule of thumb is that on screen the various textures are represented in an order
-         * as follows:
-         *  - the left part (`m_leftText`).
-         *  - the cursor (`m_cursor`) or the selected text (`m_selectedText`).
-         *  - the right part (`m_rightText`).
-         */
-        utils::Uuid m_leftText;
-        utils::Uuid m_cursor;
-        utils::Uuid m_selectedText;
-        utils::Uuid m_rightText;
+         * @brief - The role of the glyph representing the cursor. It is computed again when the
+         *          `m_cursorChanged` is `true`.
+         */
+        core::engine::Palette::ColorRole m_cursorRole;
 
         /**
          * @brief - Used to handle a darker area behind the selected text so that it stands out from
@@ -667,11 +720,6 @@ namespace sdl {
          */
         utils::Uuid m_selectionBackground;
 
-        /**
-         * @brief - Used to protect concurrent accesses to the internal data of this textbox.
-         */
-        std::mutex m_propsLocker;
-
         /**
          * @brief - Optional pointer to control the input of the textbox. If this value is `null` no
          *          control is performed to verify that the input matches some sort of convention
@@ -680,12 +728,47 @@ namespace sdl {
          */
         ValidatorShPtr m_validator;
 
+        /**
+         * @brief - The validation state of the internal text as computed by the validator. It
+         *          is updated after each edit and used when the value is retrieved so that the
+         *          text does not need to be validated again. This value is `null` if and only
+         *          if no validator is assigned to this textbox.
+         */
+        Validator::ContextShPtr m_validation;
+
+        /**
+         * @brief - The default delay without edits after which the value is notified in
+         *          `Debounced` mode.
+         */
+        static const std::chrono::milliseconds sk_defaultDebounceDelay;
+
+        /**
+         * @brief - Describes when the listeners are notified of the edits of the text. The
+         *          `m_debounceDelay` is only relevant for the `Debounced` mode.
+         */
+        NotificationMode m_notificationMode;
+        std::chrono::milliseconds m_debounceDelay;
+
+        /**
+         * @brief - Whether the text has been edited since the last notification along with
+         *          the time of the last edit (used in `Debounced` mode).
+         */
+        bool m_notificationPending;
+        std::chrono::steady_clock::time_point m_lastEdit;
+
+        /**
+         * @brief - The number of edits which were merged into another notification rather
+         *          than being notified on their own.
+         */
+        std::size_t m_suppressedNotifications;
+
       public:
 
         /**
          * @brief -  Triggered each time the user validates the content of the text box through the
-         *           return keys. Only emitted in this case and not whenever the value displayed in
-         *           the textbox changes.
+         *           return keys and whenever the user edits the text according to the notification
+         *           mode (see `setNotificationMode`). Values assigned through `setValue` are not
+         *           notified.
          */
         utils::Signal<const std::string&> onValueChanged;
     };
@@ -12,8 +12,10 @@ namespace sdl {
       const std::lock_guard guard(m_propsLocker);
 
       // Assign the validator to the internal object. We might reset a previously
-      // installed filter by doing so.
+      // installed filter by doing so. The validation state is specific to each
+      // validator so we also need to create a new one.
       m_validator = validator;
+      m_validation = (m_validator != nullptr ? m_validator->createContext() : nullptr);
     }
 
     inline
@@ -25,8 +27,14 @@ namespace sdl {
       // Check whether a validator is set for this object: if this is the case we
       // should apply it on the value displayed, try to fix it if needed and both
       // update the value displayed along with the return value.
+      std::string text = m_text.str();
+
       if (m_validator != nullptr) {
-        Validator::State s = m_validator->validate(m_text);
+        // Use the state computed while the text was edited if any.
+        Validator::State s = m_validation->state;
+        if (!m_validation->initialized) {
+          s = m_validator->reset(text, *m_validation);
+        }
 
         // Check the result of the validation.
         switch (s) {
@@ -35,23 +43,21 @@ namespace sdl {
             {
               // If the input is either invalid or intermediate we should try to fix
               // it so that we get a valid value.
-              m_validator->fixup(m_text);
+              m_validator->fixup(text);
+              m_text = text;
 
               // Check whether it is valid.
-              std::string text = m_text;
-              s = m_validator->validate(text);
+              s = m_validator->reset(text, *m_validation);
 
               if (s == Validator::State::Valid) {
                 // The validator was able to fix the input, let's reflect these changes
                 // in the text box.
-                m_text = text;
-
                 setTextChanged();
               }
               else {
                 // The text was not made valid, continue by keeping this text but by
                 // logging something.
-                warn("Could not make text \"" + m_text + "\" valid against validator, using it as is");
+                warn("Could not make text \"" + text + "\" valid against validator, using it as is");
               }
             }
             break;
@@ -65,7 +71,7 @@ namespace sdl {
       // Return the text currently displayed: it is either valid because of
       // the validator or it is not valid and the validator can't fix it so
       // better use it as is.
-      return m_text;
+      return text;
     }
 
     inline
@@ -79,67 +85,154 @@ namespace sdl {
         stopSelection();
       }
 
-      // Assign the text.
+      // Assign the text: the validation state does not describe it anymore.
       m_text = value;
       setTextChanged();
 
+      if (m_validation != nullptr) {
+        m_validation->initialized = false;
+      }
+
       // Move to the end of the string.
       updateCursorPosition(CursorMotion::Right, CursorMotionMode::ToEnd);
     }
 
+    inline
+    void
+    TextBox::setNotificationMode(const NotificationMode& mode,
+                                 std::chrono::milliseconds delay)
+    {
+      const std::lock_guard guard(m_propsLocker);
+
+      m_notificationMode = mode;
+      m_debounceDelay = delay;
+
+      // Pending notifications are delivered on the next relevant event: for
+      // time-based modes make sure that such an event happens.
+      if (m_notificationMode != NotificationMode::Debounced) {
+        DebounceTimer::getInstance().cancel(this);
+      }
+
+      if (!m_notificationPending) {
+        return;
+      }
+
+      if (m_notificationMode == NotificationMode::Debounced) {
+        scheduleNotification();
+      }
+      else {
+        requestRepaint();
+      }
+    }
+
+    inline
+    std::size_t
+    TextBox::getSuppressedNotificationsCount() noexcept {
+      const std::lock_guard guard(m_propsLocker);
+      return m_suppressedNotifications;
+    }
+
+    inline
+    GlyphCache::Stats
+    TextBox::getTextCacheStats() noexcept {
+      const std::lock_guard guard(m_propsLocker);
+      return (m_glyphs != nullptr ? m_glyphs->getStats() : GlyphCache::Stats{0u, 0u, 0u});
+    }
+
     inline
     bool
     TextBox::keyboardGrabbedEvent(const core::engine::Event& e) {
-      // Acquire the lock on the attributes of this widget.
-      const std::lock_guard guard(m_propsLocker);
+      // Acquire the lock on the attributes of this widget. It is released before
+      // registering to the blink timer as its callback acquires it.
+      std::unique_lock guard(m_propsLocker);
 
       // Update the cursor visible status, considering that as we just grabbed the
       // keyboard focus we are ready to make some modifications on the textbox and
       // thus we should display the cursor.
+      m_cursorBlinkOn = true;
       updateCursorState(true);
 
       // Use the base handler method to provide a return value.
-      return core::SdlWidget::keyboardGrabbedEvent(e);
+      const bool toReturn = core::SdlWidget::keyboardGrabbedEvent(e);
+      guard.unlock();
+
+      startBlinking();
+
+      return toReturn;
     }
 
     inline
     bool
     TextBox::keyboardReleasedEvent(const core::engine::Event& e) {
       // Acquire the lock on the attributes of this widget.
-      const std::lock_guard guard(m_propsLocker);
+      std::unique_lock guard(m_propsLocker);
 
       // Update the cursor visible status, considering that as we just lost the
       // keyboard focus the user does not want to perform modifications on the
       // textbox anymore and thus we can hide the cursor.
       updateCursorState(false);
 
+      // Leaving the textbox commits the edits which were not notified yet.
+      const bool notify = consumePendingNotification(NotificationTrigger::Commit);
+
       // Use the base handler method to provide a return value.
-      return core::SdlWidget::keyboardReleasedEvent(e);
+      const bool toReturn = core::SdlWidget::keyboardReleasedEvent(e);
+      guard.unlock();
+
+      // The cursor is hidden: no need to blink anymore. The pending edits were
+      // committed as well so the debounce delay does not matter anymore.
+      stopBlinking();
+      DebounceTimer::getInstance().cancel(this);
+
+      if (notify) {
+        notifyValue();
+      }
+
+      return toReturn;
     }
 
     inline
     bool
     TextBox::keyReleaseEvent(const core::engine::KeyEvent& e) {
       // Check whether the event concerns some sort of validation.
-      if (e.getRawKey() != core::engine::RawKey::Return &&
-          e.getRawKey() != core::engine::RawKey::KPEnter)
+      const bool commit = (
+        e.getRawKey() == core::engine::RawKey::Return ||
+        e.getRawKey() == core::engine::RawKey::KPEnter
+      );
+
+      bool notify = false;
       {
-        return core::SdlWidget::keyReleaseEvent(e);
+        const std::lock_guard guard(m_propsLocker);
+        notify = consumePendingNotification(
+          commit ? NotificationTrigger::Commit : NotificationTrigger::KeyRelease
+        );
       }
 
-      // Retrieve the value for this textbox.
-      std::string value = getValue();
-
-      // Notify listeners: we don't want to protect from concurrent
-      // accesses here as we already retrieved the value.
-      onValueChanged.safeEmit(
-        std::string("onValueChanged(") + value + ")",
-        value
-      );
+      // The value is always notified when the user validates it.
+      if (notify || commit) {
+        notifyValue();
+      }
 
       return core::SdlWidget::keyReleaseEvent(e);
     }
 
+    inline
+    bool
+    TextBox::repaintEvent(const core::engine::PaintEvent& e) {
+      // Edits gathered since the last repaint can be notified now.
+      bool notify = false;
+      {
+        const std::lock_guard guard(m_propsLocker);
+        notify = consumePendingNotification(NotificationTrigger::Repaint);
+      }
+
+      if (notify) {
+        notifyValue();
+      }
+
+      return core::SdlWidget::repaintEvent(e);
+    }
+
     inline
     bool
     TextBox::canTriggerCursorMotion(const core::engine::RawKey& k) const noexcept {
@@ -332,7 +425,16 @@ namespace sdl {
     void
     TextBox::addCharToText(char c) {
       // Insert the char at the position specified by the cursor index.
-      m_text.insert(m_text.begin() + m_cursorIndex, c);
+      m_text.insert(m_cursorIndex, c);
+
+      validateEdit(
+        Validator::Edit{
+          Validator::EditType::Insertion,
+          m_cursorIndex,
+          1u,
+          std::string_view(&c, 1u)
+        }
+      );
 
       // Update the position of the cursor index so that it stays at the
       // same position.
@@ -340,19 +442,137 @@ namespace sdl {
 
       // Mark the text as dirty.
       setTextChanged();
+      markValueChanged();
+    }
 
-      if (m_validator) {
-        Validator::State s = m_validator->validate(m_text);
-        if (s == Validator::State::Valid) {
-          info("Textbox content \"" + m_text + "\" is valid");
-        }
-        else if (s == Validator::State::Intermediate) {
-          warn("Textbox content \"" + m_text + "\" is intermediate");
-        }
-        else {
-          warn("Textbox content \"" + m_text + "\" is invalid");
+    inline
+    void
+    TextBox::validateEdit(const Validator::Edit& edit) {
+      if (m_validator == nullptr) {
+        return;
+      }
+
+      // Outside of the immediate mode the text is only validated when its
+      // value is notified: the state is thus not kept up to date.
+      if (m_notificationMode != NotificationMode::Immediate) {
+        m_validation->initialized = false;
+        return;
+      }
+
+      const bool known = m_validation->initialized;
+      const Validator::State previous = m_validation->state;
+
+      // Validate the text from both sides of the gap: gathering the text in a
+      // single piece would move the gap and cost a copy of the text on each
+      // edit done in the middle of it.
+      const Validator::State s = m_validator->update(m_text.segments(), edit, *m_validation);
+
+      // Only notify changes in the state of the text.
+      if (known && s == previous) {
+        return;
+      }
+
+      if (s == Validator::State::Valid) {
+        info("Textbox content is now valid");
+      }
+      else if (s == Validator::State::Intermediate) {
+        warn("Textbox content is now intermediate");
+      }
+      else {
+        warn("Textbox content is now invalid");
+      }
+    }
+
+    inline
+    void
+    TextBox::markValueChanged() {
+      // Edits happening while a notification is pending are merged with it.
+      if (m_notificationPending) {
+        ++m_suppressedNotifications;
+      }
+
+      m_notificationPending = true;
+
+      if (m_notificationMode == NotificationMode::Debounced) {
+        m_lastEdit = std::chrono::steady_clock::now();
+        scheduleNotification();
+      }
+    }
+
+    inline
+    void
+    TextBox::scheduleNotification() {
+      if (m_notificationMode != NotificationMode::Debounced) {
+        return;
+      }
+
+      // The callback is notified from the timer's thread with its lock held: it
+      // should not acquire the `m_propsLocker`. Requesting a repaint is enough
+      // to get back to the events processing.
+      DebounceTimer::getInstance().schedule(
+        this,
+        m_lastEdit + m_debounceDelay,
+        [this]() {
+          requestRepaint();
         }
+      );
+    }
+
+    inline
+    bool
+    TextBox::consumePendingNotification(const NotificationTrigger& trigger) {
+      if (!m_notificationPending) {
+        return false;
       }
+
+      bool notify = false;
+
+      switch (trigger) {
+        case NotificationTrigger::Commit:
+          notify = true;
+          break;
+        case NotificationTrigger::KeyRelease:
+          notify = (m_notificationMode == NotificationMode::Immediate);
+          break;
+        case NotificationTrigger::Repaint:
+          switch (m_notificationMode) {
+            case NotificationMode::Immediate:
+            case NotificationMode::PerFrame:
+              notify = true;
+              break;
+            case NotificationMode::Debounced:
+              // Edits happening after the deadline was reached scheduled a new one:
+              // the notification is emitted when it expires.
+              notify = (std::chrono::steady_clock::now() - m_lastEdit >= m_debounceDelay);
+              break;
+            case NotificationMode::OnCommit:
+            default:
+              break;
+          }
+          break;
+        default:
+          break;
+      }
+
+      if (notify) {
+        m_notificationPending = false;
+      }
+
+      return notify;
+    }
+
+    inline
+    void
+    TextBox::notifyValue() {
+      // Retrieve the value for this textbox.
+      std::string value = getValue();
+
+      // Notify listeners: we don't want to protect from concurrent
+      // accesses here as we already retrieved the value.
+      onValueChanged.safeEmit(
+        std::string("onValueChanged(") + value + ")",
+        value
+      );
     }
 
     inline
@@ -386,23 +606,6 @@ namespace sdl {
       }
     }
 
-    inline
-    void
-    TextBox::loadFont() {
-      // Only load the font if it has not yet been done.
-      if (!m_font.valid()) {
-        // Load the font.
-        m_font = getEngine().createColoredFont(m_fontName, getPalette(), m_fontSize);
-
-        if (!m_font.valid()) {
-          error(
-            std::string("Cannot create text \"") + m_text + "\"",
-            std::string("Invalid null font")
-          );
-        }
-      }
-    }
-
     inline
     void
     TextBox::loadText() {
@@ -414,30 +617,9 @@ namespace sdl {
         // Load the font.
         loadFont();
 
-        // We need to render each part of the text: this include the left part of
-        // the text, the selected part and the right part of it.
-        // The left part corresponds to the part of the internal text which is both
-        // before the cursor and the start of the selection part.
-        // The selection part corresponds to the area defined between the cursor's
-        // position and the start of the selection.
-        // The right part corresponds to the part of the internal text which is both
-        // after the cursor and the start of the selection part.
-        // Depending on the combination of values for the cursor's position and the
-        // selection start some part might be empty.
-
-        // Render each part.
-        if (hasLeftTextPart()) {
-          // Check for empty text and display a debug to help understand the problem.
-          if (getLeftText().empty()) {
-            warn(
-              "Trying to render left text ranging from " + std::to_string(m_selectionStart) + " to " +
-              std::to_string(m_cursorIndex) + " which lead to empty text"
-            );
-          }
-
-          m_leftText = getEngine().createTextureFromText(getLeftText(), m_font, m_textRole);
-        }
-
+        // Each part of the text is drawn from glyphs so there's no need to render
+        // anything here. The only texture needed is the background of the selected
+        // part of the text.
         if (hasSelectedTextPart()) {
           // Check for empty text and display a debug to help understand the problem.
           if (getSelectedText().empty()) {
@@ -447,19 +629,12 @@ namespace sdl {
             );
           }
 
-          // The role of the selected text is always `HighlightedText`.
-          m_selectedText = getEngine().createTextureFromText(
-            getSelectedText(),
-            m_font,
-            core::engine::Palette::ColorRole::HighlightedText
-          );
-
-          // Also create the selection background based on the size of the selected text.
-          // In order to obtain a fully usable texture we will perform the fill operation
+          // Create the selection background based on the size of the selected text. In
+          // order to obtain a fully usable texture we will perform the fill operation
           // for this texture here: this is a one-time operation which should be performed
           // before rendering the texture for the first time. As this method is called by
           // the main thread (through the `drawContentPrivate` interface) we CAN do that.
-          utils::Sizef sizeText = getEngine().queryTexture(m_selectedText);
+          utils::Sizef sizeText = measureText(getSelectedText(), core::engine::Palette::ColorRole::HighlightedText);
           m_selectionBackground = getEngine().createTexture(
             sizeText,
             core::engine::Palette::ColorRole::Highlight
@@ -474,27 +649,12 @@ namespace sdl {
 
           getEngine().fillTexture(m_selectionBackground, getPalette());
         }
-
-        if (hasRightTextPart()) {
-          // Check for empty text and display a debug to help understand the problem.
-          if (getRightText().empty()) {
-            warn(
-              "Trying to render right text ranging from " + std::to_string(m_selectionStart) + " to " +
-              std::to_string(m_cursorIndex) + " which lead to empty text"
-            );
-          }
-
-          m_rightText = getEngine().createTextureFromText(getRightText(), m_font, m_textRole);
-        }
       }
     }
 
     inline
     void
     TextBox::loadCursor() {
-      // Clear existing cursor if any.
-      clearCursor();
-
       // Load the font.
       loadFont();
 
@@ -503,48 +663,22 @@ namespace sdl {
       // of the selection background: indeed as the background is
       // quite dark, the base cursor's role does not contrast well
       // with it so we usually want to choose another role.
-      core::engine::Palette::ColorRole role = (
+      m_cursorRole = (
         selectionStarted() && m_cursorIndex < m_selectionStart ?
         core::engine::Palette::ColorRole::HighlightedText :
         m_textRole
       );
-
-      m_cursor = getEngine().createTextureFromText(std::string("|"), m_font, role);
     }
 
     inline
     void
     TextBox::clearText() {
-      if (m_leftText.valid()) {
-        getEngine().destroyTexture(m_leftText);
-        m_leftText.invalidate();
-      }
-
-      if (m_rightText.valid()) {
-        getEngine().destroyTexture(m_rightText);
-        m_rightText.invalidate();
-      }
-
-      if (m_selectedText.valid()) {
-        getEngine().destroyTexture(m_selectedText);
-        m_selectedText.invalidate();
-      }
-
       if (m_selectionBackground.valid()) {
         getEngine().destroyTexture(m_selectionBackground);
         m_selectionBackground.invalidate();
       }
     }
 
-    inline
-    void
-    TextBox::clearCursor() {
-      if (m_cursor.valid()) {
-        getEngine().destroyTexture(m_cursor);
-        m_cursor.invalidate();
-      }
-    }
-
     inline
     bool
     TextBox::isCursorVisible() const noexcept {
@@ -575,7 +709,7 @@ namespace sdl {
     }
 
     inline
-    std::string
+    std::string_view
     TextBox::getLeftText() const noexcept {
       // The left part of the text is the part that is not covered neither by the cursor nor
       // by the selection.
@@ -589,7 +723,7 @@ namespace sdl {
         upperBound = std::min(m_cursorIndex, m_selectionStart);
       }
 
-      return m_text.substr(0u, upperBound);
+      return m_text.view(0u, upperBound);
     }
 
     inline
@@ -610,7 +744,7 @@ namespace sdl {
     }
 
     inline
-    std::string
+    std::string_view
     TextBox::getSelectedText() const noexcept {
       // The selected part of the text is the part that spans the interbal defined by the
       // cursor's current position and the selection start. If no selection is started,
@@ -618,7 +752,7 @@ namespace sdl {
 
       // If no selection is active, no selected text part.
       if (!selectionStarted()) {
-        return std::string();
+        return std::string_view();
       }
 
       // If a selection is active define a valid interval between `m_cursorIndex` and the
@@ -626,7 +760,7 @@ namespace sdl {
       unsigned lowerBound = std::min(m_selectionStart, m_cursorIndex);
       unsigned upperBound = std::max(m_selectionStart, m_cursorIndex);
 
-      return m_text.substr(lowerBound, upperBound - lowerBound);
+      return m_text.view(lowerBound, upperBound - lowerBound);
     }
 
     inline
@@ -647,7 +781,7 @@ namespace sdl {
     }
 
     inline
-    std::string
+    std::string_view
     TextBox::getRightText() const noexcept {
       // The right part of the text is the part that is not covered neither by the cursor nor
       // by the selection.
@@ -661,7 +795,7 @@ namespace sdl {
         lowerBound = std::max(m_cursorIndex, m_selectionStart);
       }
 
-      return m_text.substr(lowerBound);
+      return m_text.view(lowerBound);
     }
 
     inline
@@ -689,8 +823,10 @@ namespace sdl {
     inline
     void
     TextBox::setCursorChanged() noexcept {
-      // Follow a similar behavior to `setTextChanged`.
+      // Follow a similar behavior to `setTextChanged`. The cursor is displayed
+      // right away when it moves whatever the phase of the blink.
       m_cursorChanged = true;
+      m_cursorBlinkOn = true;
 
       requestRepaint();
     }
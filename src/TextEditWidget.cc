@@ -0,0 +1,100 @@
+
+# include "TextEditWidget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    TextEditWidget::TextEditWidget(const std::string& name,
+                                   const std::string& font,
+                                   unsigned size,
+                                   core::SdlWidget* parent,
+                                   const utils::Sizef& area):
+      core::SdlWidget(name, area, parent),
+
+      m_fontName(font),
+      m_fontSize(size),
+      m_font(),
+
+      m_glyphsKey(),
+      m_glyphs(),
+
+      m_cursorVisible(false),
+      m_cursorBlinkOn(true),
+      m_cursorArea(),
+
+      m_propsLocker()
+    {
+      // Nothing to do.
+    }
+
+    TextEditWidget::~TextEditWidget() {
+      // Stop blinking: no callback can be issued on this widget afterwards. The
+      // derived widgets already did it in their own destructor as the derived
+      // part of the widget is destroyed at this point: this is a safety net.
+      stopBlinking();
+
+      // Clear glyphs.
+      clearGlyphs();
+
+      // Clear font.
+      if (m_font.valid()) {
+        getEngine().destroyColoredFont(m_font);
+      }
+    }
+
+    void
+    TextEditWidget::drawTextOnCanvas(std::string_view text,
+                                     const GlyphCache::Role& role,
+                                     const utils::Boxf& localDst,
+                                     const utils::Uuid& canvas,
+                                     const utils::Boxf& env,
+                                     const utils::Boxf& toUpdate)
+    {
+      // Skip the text altogether if it is not visible or if the font is
+      // not loaded yet.
+      if (m_glyphs == nullptr || !localDst.intersect(toUpdate).valid()) {
+        return;
+      }
+
+      // Each glyph is then drawn as an individual part of the text.
+      m_glyphs->draw(
+        text,
+        role,
+        localDst,
+        getEngine(),
+        m_font,
+        [this, &canvas, &env, &toUpdate](const GlyphCache::Glyph& glyph, const utils::Boxf& glyphDst) {
+          drawPartOnCanvas(glyph.texture, glyphDst, canvas, env, toUpdate);
+        }
+      );
+    }
+
+    void
+    TextEditWidget::drawPartOnCanvas(const utils::Uuid& uuid,
+                                     const utils::Boxf& localDst,
+                                     const utils::Uuid& canvas,
+                                     const utils::Boxf& env,
+                                     const utils::Boxf& toUpdate)
+    {
+      // Determine whether some part of the input `uuid` texture are spanned by the
+      // area to update.
+      utils::Boxf dstRectToUpdate = localDst.intersect(toUpdate);
+
+      if (!dstRectToUpdate.valid()) {
+        return;
+      }
+
+      // Convert the area which should be repaint to the local `uuid` coordinate
+      // frame: indeed the `dstRectToUpdate` is expressed in the parent's frame.
+      utils::Boxf srcRect = convertToLocal(dstRectToUpdate, localDst);
+
+      // Convert both the source and destination areas to engine format.
+      utils::Boxf srcRectEngine = convertToEngineFormat(srcRect, getEngine().queryTexture(uuid));
+      utils::Boxf dstRectEngine = convertToEngineFormat(dstRectToUpdate, env);
+
+      // Draw the `uuid` onto the `canvas` at last.
+      getEngine().drawTexture(uuid, &srcRectEngine, &canvas, &dstRectEngine);
+    }
+
+  }
+}
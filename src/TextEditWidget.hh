@@ -0,0 +1,195 @@
+#ifndef    TEXT_EDIT_WIDGET_HH
+# define   TEXT_EDIT_WIDGET_HH
+
+# include <mutex>
+# include <memory>
+# include <string>
+# include <string_view>
+# include <core_utils/Uuid.hh>
+# include <sdl_core/SdlWidget.hh>
+# include "SharedGlyphs.hh"
+# include "BlinkTimer.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    /**
+     * @brief - Base class for the widgets in which the user edits some text (such as
+     *          `TextBox` and `TextArea`). It handles the font, the glyphs used to draw
+     *          and measure the text and the blinking cursor so that the widgets only
+     *          need to handle the layout of their text.
+     *          The attributes are protected by the `m_propsLocker` which is shared
+     *          with the inheriting classes.
+     */
+    class TextEditWidget: public core::SdlWidget {
+      public:
+
+        virtual ~TextEditWidget();
+
+      protected:
+
+        /**
+         * @brief - Creates a new widget displaying text with the specified font.
+         * @param name - the name of `this` widget.
+         * @param font - the name of the font to use to render the text.
+         * @param size - the size of the font to use to render the text.
+         * @param parent - a pointer to the parent widget for this widget.
+         * @param area - the size hint for this widget.
+         */
+        TextEditWidget(const std::string& name,
+                       const std::string& font,
+                       unsigned size,
+                       core::SdlWidget* parent,
+                       const utils::Sizef& area);
+
+        /**
+         * @brief - Used to perform the loading of the font to use to render the text if
+         *          it is not yet available. An error is raised if the font cannot be
+         *          created.
+         *          Assumes that the `m_propsLocker` is already locked.
+         */
+        void
+        loadFont();
+
+        /**
+         * @brief - Releases the glyphs cache used by this widget. The glyphs are destroyed
+         *          in case no other widget uses them. Should be used when the font is not
+         *          valid anymore.
+         */
+        void
+        clearGlyphs();
+
+        /**
+         * @brief - Used to compute the size of the input text when drawn with the glyphs
+         *          of this widget. Missing glyphs are rendered on the fly. An empty
+         *          size is returned if the font is not loaded.
+         * @param text - the text to measure.
+         * @param role - the color role of the glyphs.
+         * @return - the size of the text.
+         */
+        utils::Sizef
+        measureText(std::string_view text,
+                    const GlyphCache::Role& role) const;
+
+        /**
+         * @brief - Similar to `drawPartOnCanvas` but draws the input `text` as a run of glyphs
+         *          covering the `localDst` area. Only the glyphs intersecting the `toUpdate`
+         *          area are repainted.
+         * @param text - the text to draw.
+         * @param role - the color role of the glyphs.
+         * @param localDst - the area covered by the text in parent coordinate frame.
+         * @param canvas - the identifier of the texture onto which the text should be drawn.
+         * @param env - a description of the size of the environment (i.e. the `canvas` texture).
+         * @param toUpdate - an area representing the area to update in parent's coordinate frame.
+         */
+        void
+        drawTextOnCanvas(std::string_view text,
+                         const GlyphCache::Role& role,
+                         const utils::Boxf& localDst,
+                         const utils::Uuid& canvas,
+                         const utils::Boxf& env,
+                         const utils::Boxf& toUpdate);
+
+        /**
+         * @brief - Used to perform the drawing of the portion of the texture described by `uuid` to
+         *          the specified `canvas`. In order to determine which portion of the `uuid` should
+         *          be repainted we use the `toUpdate` which represents an area expressed in parent's
+         *          coordinate frame of the area to update. The `localDst` represents the area in
+         *          parent's coordinate frame covered by the `uuid` texture.
+         *          By computing the intersection of both this method is able to derive and repaint
+         *          only the relevant part of the `uuid` (if any) to the provided `canvas` texture.
+         * @param uuid - The texture to repaint. We assume that this texture is valid.
+         * @param localDst - the area covered by the `uuid` texture in parent coordinate frame.
+         * @param canvas - the identifier of the texture onto which the `uuid` should be repainted.
+         * @param env - a description of the size of the environment (i.e. the `canvas` texture) which
+         *              is used to perform conversion of various areas in engine format.
+         * @param toUpdate - an area representing the area to update in parent's coordinate frame.
+         */
+        void
+        drawPartOnCanvas(const utils::Uuid& uuid,
+                         const utils::Boxf& localDst,
+                         const utils::Uuid& canvas,
+                         const utils::Boxf& env,
+                         const utils::Boxf& toUpdate);
+
+        /**
+         * @brief - Registers this widget to the shared `BlinkTimer` so that the cursor
+         *          starts blinking. Should be used when the keyboard focus is grabbed.
+         *          Assumes that the `m_propsLocker` is NOT locked as it is acquired by
+         *          the callback of the timer.
+         */
+        void
+        startBlinking();
+
+        /**
+         * @brief - Unregisters this widget from the shared `BlinkTimer`. Once this method
+         *          returns the cursor does not blink anymore.
+         *          Assumes that the `m_propsLocker` is NOT locked.
+         */
+        void
+        stopBlinking();
+
+      private:
+
+        /**
+         * @brief - Callback registered to the shared `BlinkTimer` while this widget has
+         *          the keyboard focus. Only the area covered by the cursor is repainted
+         *          so that the rest of the text is not drawn again.
+         *          Note that this method is called from the timer's thread.
+         * @param on - `true` if the cursor should be displayed in the current phase of
+         *             the blink.
+         */
+        void
+        onCursorBlink(bool on);
+
+      protected:
+
+        /**
+         * @brief - Information about the font to use to render the text. We use the `m_fontName`
+         *          and `m_fontSize` to store information while the font is not loaded yet. The
+         *          `m_font` itself holds an identifier returned by the engine which allows to
+         *          access to the font's data through the engine.
+         */
+        std::string m_fontName;
+        unsigned m_fontSize;
+        utils::Uuid m_font;
+
+        /**
+         * @brief - The glyphs used to draw and measure the text of this widget. As each code
+         *          point is only rendered once (for each role) editing the text or moving the
+         *          cursor does not render anything again. The cache is shared with the other
+         *          widgets using the same font and is acquired along with the font: the key
+         *          allows to release it when the font is destroyed.
+         */
+        std::string m_glyphsKey;
+        SharedGlyphs::CacheShPtr m_glyphs;
+
+        /**
+         * @brief - Indicates whether the cursor is visible, i.e. whether this widget has the
+         *          keyboard focus, and whether it is displayed in the current phase of the
+         *          blink. The latter is reset to `true` whenever the cursor moves so that it
+         *          stays visible as the user types.
+         */
+        bool m_cursorVisible;
+        bool m_cursorBlinkOn;
+
+        /**
+         * @brief - The area covered by the cursor the last time it was drawn, expressed in
+         *          local coordinates. Used to only repaint the cursor when it blinks. It is
+         *          invalid as long as the position of the cursor is not known.
+         */
+        utils::Boxf m_cursorArea;
+
+        /**
+         * @brief - Used to protect concurrent accesses to the internal data of this widget.
+         */
+        std::mutex m_propsLocker;
+    };
+
+    using TextEditWidgetShPtr = std::shared_ptr<TextEditWidget>;
+  }
+}
+
+# include "TextEditWidget.hxx"
+
+#endif    /* TEXT_EDIT_WIDGET_HH */
@@ -0,0 +1,93 @@
+#ifndef    TEXT_EDIT_WIDGET_HXX
+# define   TEXT_EDIT_WIDGET_HXX
+
+# include "TextEditWidget.hh"
+
+namespace sdl {
+  namespace graphic {
+
+    inline
+    void
+    TextEditWidget::loadFont() {
+      // Only load the font if it has not yet been done.
+      if (m_font.valid()) {
+        return;
+      }
+
+      m_font = getEngine().createColoredFont(m_fontName, getPalette(), m_fontSize);
+
+      if (!m_font.valid()) {
+        error(
+          std::string("Cannot create font \"") + m_fontName + "\"",
+          std::string("Invalid null font")
+        );
+      }
+
+      // Use the glyphs shared by the widgets with the same font.
+      m_glyphsKey = SharedGlyphs::keyFromFont(m_fontName, m_fontSize, getPalette());
+      m_glyphs = SharedGlyphs::getInstance().acquire(getEngine(), m_glyphsKey);
+    }
+
+    inline
+    void
+    TextEditWidget::clearGlyphs() {
+      SharedGlyphs::getInstance().release(getEngine(), m_glyphs, m_glyphsKey);
+    }
+
+    inline
+    utils::Sizef
+    TextEditWidget::measureText(std::string_view text,
+                                const GlyphCache::Role& role) const
+    {
+      if (m_glyphs == nullptr) {
+        return utils::Sizef();
+      }
+
+      return m_glyphs->measure(text, role, getEngine(), m_font);
+    }
+
+    inline
+    void
+    TextEditWidget::startBlinking() {
+      BlinkTimer::getInstance().subscribe(
+        this,
+        [this](bool on) {
+          onCursorBlink(on);
+        }
+      );
+    }
+
+    inline
+    void
+    TextEditWidget::stopBlinking() {
+      BlinkTimer::getInstance().unsubscribe(this);
+    }
+
+    inline
+    void
+    TextEditWidget::onCursorBlink(bool on) {
+      const std::lock_guard guard(m_propsLocker);
+
+      if (!m_cursorVisible || m_cursorBlinkOn == on) {
+        return;
+      }
+
+      m_cursorBlinkOn = on;
+
+      // In case the cursor was not drawn yet, we don't know where it lies: the
+      // next repaint will handle it.
+      if (!m_cursorArea.valid()) {
+        requestRepaint();
+        return;
+      }
+
+      std::shared_ptr<core::engine::PaintEvent> pe = std::make_shared<core::engine::PaintEvent>(this);
+      pe->addUpdateRegion(mapToGlobal(m_cursorArea));
+
+      postEvent(pe);
+    }
+
+  }
+}
+
+#endif    /* TEXT_EDIT_WIDGET_HXX */
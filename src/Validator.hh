@@ -3,7 +3,12 @@
 
 # include <memory>
 # include <string>
+# include <vector>
+# include <cstdint>
+# include <utility>
+# include <string_view>
 # include <core_utils/CoreObject.hh>
+# include "Validator_utils.hxx"
 
 namespace sdl {
   namespace graphic {
@@ -15,13 +20,61 @@ namespace sdl {
          * @brief - Used to define the state of an expression to validate. Along with the `Valid`
          *          and `Invalid` which are self-explanatory we also add thr `Intermediate` case
          *          which describes a value which is not yet valid but not obivously invalid neither.
+         *          States are stored on a single byte so that arrays of states are packed.
          */
-        enum class State {
+        enum class State: std::uint8_t {
           Invalid,
           Intermediate,
           Valid
         };
 
+        /**
+         * @brief - Describes the kind of modification applied to a text between two
+         *          validations.
+         */
+        enum class EditType {
+          Insertion,
+          Removal
+        };
+
+        /**
+         * @brief - Describes a modification applied to a text: either some characters
+         *          inserted at `position` or `count` characters removed starting from
+         *          `position`. For insertions the `chars` are the inserted characters.
+         */
+        struct Edit {
+          EditType type;
+          std::size_t position;
+          std::size_t count;
+          std::string_view chars;
+        };
+
+        /**
+         * @brief - Validation state carried between two edits of the same text. The
+         *          base version only remembers the last verdict while inheriting
+         *          validators can extend it with their own parse state so that the
+         *          verdict can be updated from the edit alone.
+         *          Such a context should be created through `createContext` of the
+         *          validator which will use it.
+         */
+        struct Context {
+          virtual ~Context() = default;
+
+          bool initialized = false;
+          std::size_t size = 0u;
+          State state = State::Intermediate;
+        };
+
+        using ContextShPtr = std::shared_ptr<Context>;
+
+        using States = std::vector<State>;
+
+        /**
+         * @brief - A text stored in two parts, typically on each side of the gap of a
+         *          gap buffer. The text is the concatenation of both parts.
+         */
+        using Segments = std::pair<std::string_view, std::string_view>;
+
       public:
 
         /**
@@ -57,6 +110,175 @@ namespace sdl {
          */
         virtual void
         fixup(std::string& input) const;
+
+        /**
+         * @brief - Creates a new context which can be used to validate a text edit
+         *          after edit with this validator. Inheriting classes which handle
+         *          incremental validation should specialize it to return a context
+         *          able to hold their parse state.
+         * @return - a new context suited for this validator.
+         */
+        virtual ContextShPtr
+        createContext() const;
+
+        /**
+         * @brief - Performs a full validation of the `input` and stores the result
+         *          in the `context` so that later edits can be validated from it.
+         * @param input - the input string to validate.
+         * @param context - the context to initialize.
+         * @return - a value among the enumeration to indicate the validity of the input.
+         */
+        State
+        reset(std::string_view input,
+              Context& context) const;
+
+        /**
+         * @brief - Similar to the above method but for a text stored in two parts.
+         * @param input - the input text to validate.
+         * @param context - the context to initialize.
+         * @return - a value among the enumeration to indicate the validity of the input.
+         */
+        State
+        reset(const Segments& input,
+              Context& context) const;
+
+        /**
+         * @brief - Updates the verdict held by the `context` to account for the input
+         *          `edit`, which transformed the text previously validated into `input`.
+         *          In case the validator is not able to handle the edit incrementally
+         *          or if the context does not describe the text before the edit, a
+         *          full validation is performed.
+         * @param input - the text after the edit was applied.
+         * @param edit - the modification applied to the text.
+         * @param context - the context holding the validation state of the text.
+         * @return - a value among the enumeration to indicate the validity of the input.
+         */
+        State
+        update(std::string_view input,
+               const Edit& edit,
+               Context& context) const;
+
+        /**
+         * @brief - Similar to the above method but for a text stored in two parts. This
+         *          allows a text held in a gap buffer to be validated without gathering
+         *          it in a single piece: the cost of an edit handled incrementally only
+         *          depends on the edit.
+         * @param input - the text after the edit was applied.
+         * @param edit - the modification applied to the text.
+         * @param context - the context holding the validation state of the text.
+         * @return - a value among the enumeration to indicate the validity of the input.
+         */
+        State
+        update(const Segments& input,
+               const Edit& edit,
+               Context& context) const;
+
+        /**
+         * @brief - Validates each of the input values and returns the corresponding states
+         *          in the same order. This is meant to validate large sets of values (such
+         *          as a column of imported data) without paying the cost of a virtual call
+         *          and of a string copy for each value.
+         *          In case the validator supports it, large inputs are split among several
+         *          threads.
+         * @param inputs - the values to validate.
+         * @return - the state of each input value.
+         */
+        States
+        validateAll(const std::vector<std::string_view>& inputs) const;
+
+        /**
+         * @brief - Similar to `validateAll` but takes a single buffer where values are
+         *          separated by the `delimiter` character. Note that a trailing delimiter
+         *          at the end of the buffer does not produce an additional empty value.
+         * @param buffer - the buffer containing the values to validate.
+         * @param delimiter - the character separating two values in the buffer.
+         * @return - the state of each value of the buffer.
+         */
+        States
+        validateAll(std::string_view buffer,
+                    char delimiter) const;
+
+      protected:
+
+        /**
+         * @brief - Used by `validateAll` to validate the `count` values starting at `inputs`
+         *          and save the results in `states`. The default implementation calls the
+         *          `validate` method for each value: inheriting classes are encouraged to
+         *          provide a version which does not copy the values.
+         * @param inputs - pointer to the first value to validate.
+         * @param count - the number of values to validate.
+         * @param states - pointer to the first state to fill.
+         */
+        virtual void
+        validateRange(const std::string_view* inputs,
+                      std::size_t count,
+                      State* states) const;
+
+        /**
+         * @brief - Used to determine whether `validateRange` can be called concurrently
+         *          from several threads. The default implementation returns `false` as
+         *          nothing is known about inheriting validators.
+         * @return - `true` if the validation can be split among several threads.
+         */
+        virtual bool
+        canValidateConcurrently() const noexcept;
+
+        /**
+         * @brief - Context holding the components of the number being validated. The
+         *          validators of numbers should return such a context when asked to
+         *          `createContext` and implement `evaluate`: the components are then
+         *          kept up to date when the text is edited.
+         */
+        struct NumberContext: Context {
+          number::Components components;
+        };
+
+        /**
+         * @brief - Used by `reset` to fill the `context` from the full `input`. In case
+         *          the context is a `NumberContext` the input is parsed and its verdict
+         *          is produced by `evaluate`. Otherwise both parts of the text are
+         *          gathered, `validate` is used and only the verdict is kept.
+         * @param input - the input text to validate.
+         * @param context - the context to initialize.
+         * @return - the verdict for the input text.
+         */
+        virtual State
+        initializeContext(const Segments& input,
+                          Context& context) const;
+
+        /**
+         * @brief - Used by `update` to apply the `edit` to the parse state held by the
+         *          `context` and update its verdict. The default implementation handles
+         *          edits at the end of the text (which is where characters are typed
+         *          most of the time) on a `NumberContext`: their cost only depends on
+         *          the size of the edit. Other edits are not handled.
+         * @param edit - the modification applied to the text.
+         * @param context - the context to update.
+         * @return - `true` if the edit could be handled (in which case the verdict in
+         *           the context is up to date) and `false` otherwise.
+         */
+        virtual bool
+        updateContext(const Edit& edit,
+                      Context& context) const;
+
+        /**
+         * @brief - Used to produce the verdict for the number described by the input
+         *          components when a `NumberContext` is used. The default implementation
+         *          only checks that the components follow the grammar of a number.
+         * @param number - the components of the number to validate.
+         * @return - a value among the enumeration to indicate the validity of the number.
+         */
+        virtual State
+        evaluate(const number::Components& number) const;
+
+      private:
+
+        /**
+         * @brief - The minimum number of values to validate for each thread used by the
+         *          `validateAll` method. Below this count spawning threads costs more than
+         *          it saves.
+         */
+        static constexpr std::size_t sk_minValuesPerThread = 1u << 15;
     };
 
     using ValidatorShPtr = std::shared_ptr<Validator>;
@@ -2,6 +2,9 @@
 # define   VALIDATOR_HXX
 
 # include "Validator.hh"
+# include <thread>
+# include <algorithm>
+# include <exception>
 
 namespace sdl {
   namespace graphic {
@@ -22,6 +25,242 @@ namespace sdl {
       // Nothing magic at this level. Inheriting classes are encouraged to do better.
     }
 
+    inline
+    Validator::ContextShPtr
+    Validator::createContext() const {
+      return std::make_shared<Context>();
+    }
+
+    inline
+    Validator::State
+    Validator::reset(std::string_view input,
+                     Context& context) const
+    {
+      return reset(Segments(input, std::string_view()), context);
+    }
+
+    inline
+    Validator::State
+    Validator::reset(const Segments& input,
+                     Context& context) const
+    {
+      context.state = initializeContext(input, context);
+      context.size = input.first.size() + input.second.size();
+      context.initialized = true;
+
+      return context.state;
+    }
+
+    inline
+    Validator::State
+    Validator::update(std::string_view input,
+                      const Edit& edit,
+                      Context& context) const
+    {
+      return update(Segments(input, std::string_view()), edit, context);
+    }
+
+    inline
+    Validator::State
+    Validator::update(const Segments& input,
+                      const Edit& edit,
+                      Context& context) const
+    {
+      const std::size_t size = input.first.size() + input.second.size();
+
+      // Make sure that the context describes the text before the edit: this is
+      // verified by checking that the edit yields a text with the right size.
+      bool consistent = context.initialized;
+
+      switch (edit.type) {
+        case EditType::Insertion:
+          consistent = consistent && context.size + edit.chars.size() == size;
+          break;
+        case EditType::Removal:
+          consistent = consistent && edit.count <= context.size && context.size - edit.count == size;
+          break;
+        default:
+          consistent = false;
+          break;
+      }
+
+      if (!consistent || !updateContext(edit, context)) {
+        return reset(input, context);
+      }
+
+      context.size = size;
+
+      return context.state;
+    }
+
+    inline
+    Validator::States
+    Validator::validateAll(const std::vector<std::string_view>& inputs) const {
+      States states(inputs.size(), State::Invalid);
+
+      // Determine how many threads can be used: we don't want to use more than
+      // the hardware can handle nor to spawn threads for small chunks of data.
+      std::size_t threads = 1u;
+      if (canValidateConcurrently()) {
+        const std::size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        threads = std::max<std::size_t>(1u, std::min(hardware, inputs.size() / sk_minValuesPerThread));
+      }
+
+      if (threads == 1u) {
+        validateRange(inputs.data(), inputs.size(), states.data());
+        return states;
+      }
+
+      // Split the values in contiguous chunks: the last one is processed by the
+      // calling thread. An exception escaping a worker would terminate the program
+      // so each chunk saves its own error which is rethrown once all the workers
+      // have been joined. Workers are joined on destruction in case the creation
+      // of one of them fails.
+      const std::size_t chunk = (inputs.size() + threads - 1u) / threads;
+
+      std::vector<std::exception_ptr> errors(threads);
+      std::vector<std::jthread> workers;
+      workers.reserve(threads - 1u);
+
+      auto process = [this, &inputs, &states, &errors, chunk](std::size_t id) {
+        const std::size_t start = id * chunk;
+        const std::size_t count = std::min(chunk, inputs.size() - start);
+
+        try {
+          validateRange(inputs.data() + start, count, states.data() + start);
+        }
+        catch (...) {
+          errors[id] = std::current_exception();
+        }
+      };
+
+      for (std::size_t id = 0u ; id < threads - 1u ; ++id) {
+        workers.emplace_back(process, id);
+      }
+
+      process(threads - 1u);
+
+      for (std::jthread& worker : workers) {
+        worker.join();
+      }
+
+      for (const std::exception_ptr& error : errors) {
+        if (error) {
+          std::rethrow_exception(error);
+        }
+      }
+
+      return states;
+    }
+
+    inline
+    Validator::States
+    Validator::validateAll(std::string_view buffer,
+                           char delimiter) const
+    {
+      // Split the buffer into values: the views reference the input buffer so
+      // the values are not copied.
+      std::vector<std::string_view> inputs;
+      inputs.reserve(std::count(buffer.cbegin(), buffer.cend(), delimiter) + 1u);
+
+      std::size_t start = 0u;
+      while (start < buffer.size()) {
+        const std::size_t end = std::min(buffer.find(delimiter, start), buffer.size());
+        inputs.push_back(buffer.substr(start, end - start));
+
+        start = end + 1u;
+      }
+
+      return validateAll(inputs);
+    }
+
+    inline
+    void
+    Validator::validateRange(const std::string_view* inputs,
+                             std::size_t count,
+                             State* states) const
+    {
+      for (std::size_t id = 0u ; id < count ; ++id) {
+        states[id] = validate(std::string(inputs[id]));
+      }
+    }
+
+    inline
+    bool
+    Validator::canValidateConcurrently() const noexcept {
+      return false;
+    }
+
+    inline
+    Validator::State
+    Validator::initializeContext(const Segments& input,
+                                 Context& context) const
+    {
+      // The parser handles the text character by character so both parts
+      // can be parsed one after the other.
+      NumberContext* ctx = dynamic_cast<NumberContext*>(&context);
+      if (ctx != nullptr) {
+        ctx->components = number::parse(input.first);
+        number::push(ctx->components, input.second);
+
+        return evaluate(ctx->components);
+      }
+
+      std::string text;
+      text.reserve(input.first.size() + input.second.size());
+
+      text.append(input.first);
+      text.append(input.second);
+
+      return validate(text);
+    }
+
+    inline
+    bool
+    Validator::updateContext(const Edit& edit,
+                             Context& context) const
+    {
+      NumberContext* ctx = dynamic_cast<NumberContext*>(&context);
+      if (ctx == nullptr) {
+        return false;
+      }
+
+      // Only edits at the end of the text can be applied on the components:
+      // other modifications require to parse the text again.
+      number::Components& components = ctx->components;
+
+      switch (edit.type) {
+        case EditType::Insertion:
+          if (edit.position != components.size) {
+            return false;
+          }
+          number::push(components, edit.chars);
+          break;
+        case EditType::Removal:
+          if (edit.position + edit.count != components.size) {
+            return false;
+          }
+          number::pop(components, edit.count);
+          break;
+        default:
+          return false;
+      }
+
+      context.state = evaluate(components);
+
+      return true;
+    }
+
+    inline
+    Validator::State
+    Validator::evaluate(const number::Components& number) const {
+      if (number.invalid > 0u) {
+        return State::Invalid;
+      }
+
+      return (number::isComplete(number) ? State::Valid : State::Intermediate);
+    }
+
   }
 }
 
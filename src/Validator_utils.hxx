@@ -1,11 +1,15 @@
 #ifndef    VALIDATOR_UTILS_HXX
 # define   VALIDATOR_UTILS_HXX
 
-# include <string>
-# include <sstream>
-# include <stdexcept>
-# include <core_utils/Conversion.hh>
-# include <core_utils/CoreException.hh>
+# include <bit>
+# include <cmath>
+# include <limits>
+# include <cstring>
+# include <charconv>
+# include <cstdint>
+# include <algorithm>
+# include <string_view>
+# include <system_error>
 
 namespace sdl {
   namespace graphic {
@@ -21,6 +25,445 @@ namespace sdl {
         Scientific
       };
 
+      /**
+       * @brief - The maximum number of significant digits kept for each part of a number.
+       *          Digits beyond this count are still counted but do not contribute to the
+       *          value which would otherwise overflow.
+       */
+      inline constexpr unsigned maxDigits = 19u;
+
+      /**
+       * @brief - Summary of a string supposedly representing a number. The string is
+       *          described by its sign, its leading and decimal digits and its exponent
+       *          so that a validator can produce a verdict without looking at the text
+       *          again. The summary is built one character at a time which allows to
+       *          carry it forward when characters are added or removed at the end of
+       *          the text.
+       *          The grammar recognized is `[+-]?[0-9]*([.,][0-9]*)?([eE][+-]?[0-9]*)?`
+       *          where the exponent can only follow at least one digit. Any character
+       *          which does not fit makes the rest of the string invalid.
+       *          For each part the leading zeros are counted separately so that the
+       *          value always holds the significant digits.
+       */
+      struct Components {
+        std::size_t size = 0u;
+
+        char sign = '\0';
+
+        unsigned leadDigits = 0u;
+        unsigned leadZeros = 0u;
+        std::uint64_t lead = 0u;
+
+        bool separator = false;
+        unsigned decDigits = 0u;
+        unsigned decZeros = 0u;
+        std::uint64_t decimals = 0u;
+
+        bool exponent = false;
+        char expSign = '\0';
+        unsigned expDigits = 0u;
+        unsigned expZeros = 0u;
+        std::uint64_t exp = 0u;
+
+        unsigned invalid = 0u;
+      };
+
+      /**
+       * @brief - Used to compute the number of digits needed to write the input value
+       *          in base 10. Note that `0` is considered to use `1` digit.
+       * @param value - the value for which the digits should be counted.
+       * @return - the number of digits of the value.
+       */
+      inline
+      int
+      countDigits(std::uint64_t value) noexcept {
+        int digits = 1;
+        while (value >= 10u) {
+          value /= 10u;
+          ++digits;
+        }
+
+        return digits;
+      }
+
+      /**
+       * @brief - Appends the character `c` at the end of the number described by the
+       *          input components.
+       * @param number - the components to update.
+       * @param c - the character to append.
+       */
+      inline
+      void
+      push(Components& number,
+           char c) noexcept
+      {
+        ++number.size;
+
+        // Once an invalid character has been found, all the following ones are
+        // considered invalid as well: this allows to remove them one by one.
+        if (number.invalid > 0u) {
+          ++number.invalid;
+          return;
+        }
+
+        const bool digit = (c >= '0' && c <= '9');
+        const bool sign = (c == '+' || c == '-');
+
+        auto accumulate = [c](std::uint64_t& value, unsigned& digits, unsigned& zeros) {
+          if (digits == zeros && c == '0') {
+            ++zeros;
+          }
+          else if (digits - zeros < maxDigits) {
+            value = value * 10u + static_cast<unsigned>(c - '0');
+          }
+          ++digits;
+        };
+
+        if (number.exponent) {
+          if (digit) {
+            accumulate(number.exp, number.expDigits, number.expZeros);
+          }
+          else if (sign && number.expSign == '\0' && number.expDigits == 0u) {
+            number.expSign = c;
+          }
+          else {
+            ++number.invalid;
+          }
+
+          return;
+        }
+
+        if (digit) {
+          if (number.separator) {
+            accumulate(number.decimals, number.decDigits, number.decZeros);
+          }
+          else {
+            accumulate(number.lead, number.leadDigits, number.leadZeros);
+          }
+        }
+        else if (sign && number.size == 1u) {
+          number.sign = c;
+        }
+        else if ((c == '.' || c == ',') && !number.separator) {
+          number.separator = true;
+        }
+        else if ((c == 'e' || c == 'E') && number.leadDigits + number.decDigits > 0u) {
+          number.exponent = true;
+        }
+        else {
+          ++number.invalid;
+        }
+      }
+
+      /**
+       * @brief - Used to convert the 8 characters starting at `chars` into the value
+       *          they represent in case they are all digits. The characters are read
+       *          as a single word: they are classified and combined with a handful of
+       *          arithmetic operations (SIMD within a register) instead of looping on
+       *          each of them.
+       *          The word is assumed to be stored in little endian order, the method
+       *          always fails on other platforms.
+       * @param chars - pointer to the first of the 8 characters to convert.
+       * @param value - output argument receiving the value of the 8 digits.
+       * @return - `true` if all the characters are digits.
+       */
+      inline
+      bool
+      parseEightDigits(const char* chars,
+                       std::uint64_t& value) noexcept
+      {
+        if constexpr (std::endian::native != std::endian::little) {
+          return false;
+        }
+
+        std::uint64_t word;
+        std::memcpy(&word, chars, sizeof(word));
+
+        // A byte is a digit if its high nibble is `3` and if adding `6` to it does
+        // not carry into the high nibble (i.e. its low nibble is at most `9`).
+        constexpr std::uint64_t high = 0xF0F0F0F0F0F0F0F0u;
+        const bool digits = ((word & high) | (((word + 0x0606060606060606u) & high) >> 4u)) == 0x3333333333333333u;
+
+        if (!digits) {
+          return false;
+        }
+
+        // Combine pairs of digits, then pairs of pairs and so on: the first
+        // character is the most significant digit.
+        word -= 0x3030303030303030u;
+        word = (word * 10u) + (word >> 8u);
+        word = (
+          ((word & 0x000000FF000000FFu) * (100u + (1000000ull << 32u))) +
+          (((word >> 16u) & 0x000000FF000000FFu) * (1u + (10000ull << 32u)))
+        ) >> 32u;
+
+        value = static_cast<std::uint32_t>(word);
+
+        return true;
+      }
+
+      /**
+       * @brief - Appends all the characters of `chars` at the end of the number.
+       *          Long runs of digits are handled 8 characters at a time as long as
+       *          they only contribute significant digits to the current part of the
+       *          number: other characters go through the regular path.
+       * @param number - the components to update.
+       * @param chars - the characters to append.
+       */
+      inline
+      void
+      push(Components& number,
+           std::string_view chars) noexcept
+      {
+        constexpr std::size_t word = 8u;
+        constexpr std::uint64_t scale = 100000000u;
+
+        std::size_t id = 0u;
+
+        while (id < chars.size()) {
+          // Select the part of the number receiving the digits.
+          std::uint64_t* value = &number.lead;
+          unsigned* digits = &number.leadDigits;
+          unsigned* zeros = &number.leadZeros;
+
+          if (number.exponent) {
+            value = &number.exp;
+            digits = &number.expDigits;
+            zeros = &number.expZeros;
+          }
+          else if (number.separator) {
+            value = &number.decimals;
+            digits = &number.decDigits;
+            zeros = &number.decZeros;
+          }
+
+          std::uint64_t chunk = 0u;
+          const bool fast =
+            number.invalid == 0u &&
+            chars.size() - id >= word &&
+            *digits > *zeros &&
+            *digits - *zeros + word <= maxDigits &&
+            parseEightDigits(chars.data() + id, chunk)
+          ;
+
+          if (fast) {
+            *value = *value * scale + chunk;
+            *digits += word;
+            number.size += word;
+            id += word;
+          }
+          else {
+            push(number, chars[id]);
+            ++id;
+          }
+        }
+      }
+
+      /**
+       * @brief - Removes the last `count` characters of the number described by the
+       *          input components. As the grammar is strictly ordered, the structure
+       *          of the components is enough to determine which part is affected.
+       * @param number - the components to update.
+       * @param count - the number of characters to remove.
+       */
+      inline
+      void
+      pop(Components& number,
+          std::size_t count = 1u) noexcept
+      {
+        auto drop = [](std::uint64_t& value, unsigned& digits, unsigned& zeros) {
+          if (digits == zeros) {
+            --zeros;
+          }
+          else if (digits - zeros <= maxDigits) {
+            value /= 10u;
+          }
+          --digits;
+        };
+
+        while (count > 0u && number.size > 0u) {
+          --count;
+          --number.size;
+
+          if (number.invalid > 0u) {
+            --number.invalid;
+          }
+          else if (number.exponent) {
+            if (number.expDigits > 0u) {
+              drop(number.exp, number.expDigits, number.expZeros);
+            }
+            else if (number.expSign != '\0') {
+              number.expSign = '\0';
+            }
+            else {
+              number.exponent = false;
+            }
+          }
+          else if (number.separator) {
+            if (number.decDigits > 0u) {
+              drop(number.decimals, number.decDigits, number.decZeros);
+            }
+            else {
+              number.separator = false;
+            }
+          }
+          else if (number.leadDigits > 0u) {
+            drop(number.lead, number.leadDigits, number.leadZeros);
+          }
+          else {
+            number.sign = '\0';
+          }
+        }
+      }
+
+      /**
+       * @brief - Builds the components describing the input string in a single pass.
+       * @param input - the string to analyze.
+       * @return - the components describing the input string.
+       */
+      inline
+      Components
+      parse(std::string_view input) noexcept {
+        Components number;
+        push(number, input);
+
+        return number;
+      }
+
+      /**
+       * @brief - Used to determine whether the number is complete, i.e. has at least
+       *          a digit in its mantissa and in its exponent if any. An incomplete but
+       *          otherwise correct number can still be made valid by adding digits.
+       * @param number - the components to check.
+       * @return - `true` if the number is complete.
+       */
+      inline
+      bool
+      isComplete(const Components& number) noexcept {
+        return
+          number.invalid == 0u &&
+          number.leadDigits + number.decDigits > 0u &&
+          (!number.exponent || number.expDigits > 0u)
+        ;
+      }
+
+      /**
+       * @brief - Computes the floating point value described by the input components.
+       *          The conversion fails if the number is not complete or if the value
+       *          cannot be represented by a float. Just like `strtof` does, values
+       *          which are too small to be represented as normal floats (subnormal
+       *          values) are considered out of range.
+       *          The components are written back in a normalized form in a buffer on
+       *          the stack which is then converted with `std::from_chars`: this yields
+       *          a correctly rounded value without allocating nor throwing.
+       * @param number - the components describing the number.
+       * @param value - output argument receiving the value of the number.
+       * @return - `true` if the conversion succeeded.
+       */
+      inline
+      bool
+      toFloat(const Components& number,
+              float& value) noexcept
+      {
+        if (!isComplete(number)) {
+          return false;
+        }
+
+        // Fast path: a mantissa of at most 7 digits and a power of ten up to `10^10`
+        // are both exactly representable as floats, so a single multiplication or
+        // division yields the correctly rounded value.
+        constexpr float powers[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+        constexpr unsigned fastDigits = 7u;
+        constexpr int fastExponent = 10;
+
+        const unsigned fractional = number.decDigits;
+        if (number.leadDigits + fractional <= fastDigits && number.expDigits - number.expZeros <= 2u) {
+          std::uint64_t mantissa = number.lead;
+          for (unsigned id = 0u ; id < fractional ; ++id) {
+            mantissa *= 10u;
+          }
+          mantissa += number.decimals;
+
+          int e = static_cast<int>(number.exp) * (number.expSign == '-' ? -1 : 1) - static_cast<int>(fractional);
+
+          if (e >= -fastExponent && e <= fastExponent) {
+            const float m = static_cast<float>(mantissa);
+            const float v = (e < 0 ? m / powers[-e] : m * powers[e]);
+
+            value = (number.sign == '-' ? -v : v);
+            return true;
+          }
+        }
+
+        // The number is written as its significant digits followed by an exponent.
+        // The buffer is large enough for a sign, the leading and decimal digits, the
+        // zeros separating them and a clamped exponent.
+        char buffer[96];
+        char* it = buffer;
+        char* const end = buffer + sizeof(buffer);
+
+        if (number.sign == '-') {
+          *it++ = '-';
+        }
+
+        const unsigned leadSignificant = number.leadDigits - number.leadZeros;
+        const unsigned decSignificant = std::min(number.decDigits - number.decZeros, maxDigits);
+
+        // The exponent is clamped to a value large enough to produce an out of range
+        // conversion for any non-zero number. It is then corrected to account for the
+        // digits which are not written in the buffer.
+        constexpr std::int64_t clamp = 100000;
+        constexpr unsigned maxZeros = 20u;
+
+        std::int64_t exponent = static_cast<std::int64_t>(std::min(number.exp, static_cast<std::uint64_t>(clamp)));
+        if (number.expSign == '-') {
+          exponent = -exponent;
+        }
+
+        if (leadSignificant > 0u) {
+          it = std::to_chars(it, end, number.lead).ptr;
+
+          // Leading digits beyond the maximum count were not accumulated. In this
+          // case or if the decimals start too far after the separator they cannot
+          // change the value of a float and are ignored.
+          if (leadSignificant > maxDigits) {
+            exponent += leadSignificant - maxDigits;
+          }
+          else if (decSignificant > 0u && number.decZeros <= maxZeros) {
+            it = std::fill_n(it, number.decZeros, '0');
+            it = std::to_chars(it, end, number.decimals).ptr;
+            exponent -= number.decZeros + decSignificant;
+          }
+        }
+        else if (decSignificant > 0u) {
+          it = std::to_chars(it, end, number.decimals).ptr;
+          exponent -= number.decZeros + decSignificant;
+        }
+        else {
+          *it++ = '0';
+        }
+
+        *it++ = 'e';
+        it = std::to_chars(it, end, exponent).ptr;
+
+        float converted = 0.0f;
+        const std::from_chars_result res = std::from_chars(buffer, it, converted);
+
+        if (res.ec != std::errc() || res.ptr != it) {
+          return false;
+        }
+
+        // Unlike `strtof`, `from_chars` may accept subnormal values: reject them
+        // so that such inputs are still reported as out of range.
+        if (converted != 0.0f && std::fabs(converted) < std::numeric_limits<float>::min()) {
+          return false;
+        }
+
+        value = converted;
+
+        return true;
+      }
+
     }
 
     /**
@@ -31,9 +474,10 @@ namespace sdl {
      *          the aforementionned example respectively `1`, `2` and `3`).
      *          In case nothing is entered yet the returned value is `0` and the
      *          associated boolean is set to `false`.
-     *          Note that the input string is assumed to be a *valid* number in the
-     *          scientific notation space: if this is not the case it causes undefined
-     *          behavior.
+     *          The input is analyzed in a single pass without allocating: in case
+     *          it does not represent a number in scientific notation or if one of
+     *          the components does not fit in an integer, `false` is returned and
+     *          the output arguments are left untouched.
      * @param input - the string representing a number in scientific notation to
      *                interpret.
      * @param leading - the leading digits of this number. Should be at most one digit
@@ -43,114 +487,60 @@ namespace sdl {
      * @param hasDecimals - `true` if the input string contains some decimals.
      * @param exponent - the exponent of this number.
      * @param hasExponent - `true` if the input string contains an exponent.
+     * @return - `true` if the components could be extracted.
      */
     inline
-    void
-    extractComponents(const std::string& input,
+    bool
+    extractComponents(std::string_view input,
                       int* leading = nullptr,
                       bool* hasLeading = nullptr,
                       int* decimals = nullptr,
                       bool* hasDecimals = nullptr,
                       int* exponent = nullptr,
-                      bool* hasExponent = nullptr)
+                      bool* hasExponent = nullptr) noexcept
     {
-      // The structure of a number in scientific notation should be something like `1.2e3`.
-      // We will first try to determine whether each part is filled or if some are missing.
-      std::size_t indexDecSep = std::min(input.find('.'), input.find(','));
-      std::size_t indexExp = std::min(input.find('e'), input.find('E'));
-
-      bool leadExist = (std::min(indexDecSep, indexExp) > 0);
-      bool decExist = (indexDecSep != std::string::npos);
-      bool expExist = (indexExp != std::string::npos);
-
-      // Tokenize the string into the corresponding values. Note that we take full advantage
-      // of the fact that we know beforehand the structure of a number in scientific notation.
-
-      // The leading part runs until we reach either the end of the string, the first decimals
-      // or the exponent.
-      std::string strLead;
-      if (leadExist) {
-        strLead = input.substr(0, std::min(indexDecSep, indexExp));
+      const number::Components number = number::parse(input);
+      if (number.invalid > 0u) {
+        return false;
       }
 
-      std::string strDec;
-      if (decExist && indexDecSep < input.size() - 1) {
-        strDec = input.substr(indexDecSep + 1u, indexExp - (indexDecSep + 1u));
+      // Each component should fit in an integer.
+      constexpr std::uint64_t limit = static_cast<std::uint64_t>(std::numeric_limits<int>::max());
+      if (number.lead > limit || number.decimals > limit || number.exp > limit ||
+          number.leadDigits - number.leadZeros > number::maxDigits ||
+          number.decDigits - number.decZeros > number::maxDigits ||
+          number.expDigits - number.expZeros > number::maxDigits)
+      {
+        return false;
       }
 
-      std::string strExp;
-      if (expExist && indexExp < input.size() - 1) {
-        strExp = input.substr(indexExp + 1u);
-      }
+      const int lead = static_cast<int>(number.lead);
+      const int exp = static_cast<int>(number.exp);
 
-      // Convert each component to an int.
-      bool ok = false;
-
-      // If the user wants to retrieve the leading part of the number.
+      // The leading part runs until we reach either the end of the string, the first
+      // decimals or the exponent and includes the sign of the number.
+      if (hasLeading != nullptr) {
+        *hasLeading = (number.sign != '\0' || number.leadDigits > 0u);
+      }
       if (leading != nullptr) {
-        if (hasLeading != nullptr) {
-          *hasLeading = leadExist;
-        }
-
-        if (!leadExist) {
-          *leading = 0;
-        }
-        else {
-          *leading = utils::convertToInt(strLead, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert leading part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *leading = (number.sign == '-' ? -lead : lead);
       }
 
-      // If the user wants to retrieve the decimal part of the number.
+      if (hasDecimals != nullptr) {
+        *hasDecimals = number.separator;
+      }
       if (decimals != nullptr) {
-        if (hasDecimals != nullptr) {
-          *hasDecimals = decExist;
-        }
-
-        if (!decExist) {
-          *decimals = 0;
-        }
-        else {
-          *decimals = utils::convertToInt(strDec, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert decimals part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *decimals = static_cast<int>(number.decimals);
       }
 
-      // If the user wants to retrieve the exponent part of the number.
+      if (hasExponent != nullptr) {
+        *hasExponent = number.exponent;
+      }
       if (exponent != nullptr) {
-        if (hasExponent != nullptr) {
-          *hasExponent = expExist;
-        }
-
-        if (!expExist) {
-          *exponent = 0;
-        }
-        else {
-          *exponent = utils::convertToInt(strExp, &ok);
-          if (!ok) {
-            throw utils::CoreException(
-              std::string("Could not convert exponent part of number \"") + input + "\"",
-              std::string("float"),
-              std::string("validator"),
-              std::string("Invalid conversion to integer")
-            );
-          }
-        }
+        *exponent = (number.expSign == '-' ? -exp : exp);
       }
+
+      return true;
     }
 
   }